@@ -0,0 +1,523 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Execution
+{
+	constexpr size_t MinChunkSize = 4096;
+
+	inline size_t HardwareConcurrency()
+	{
+		return std::max<size_t>(1, std::thread::hardware_concurrency());
+	}
+
+	inline size_t ChunkCount(size_t size, size_t concurrency)
+	{
+		if(concurrency == 0)
+		{
+			concurrency = HardwareConcurrency();
+		}
+
+		return std::clamp<size_t>(size / MinChunkSize, 1, concurrency);
+	}
+
+	class OnceFlag
+	{
+	private:
+		static constexpr uint8_t Idle = 0;
+		static constexpr uint8_t Running = 1;
+		static constexpr uint8_t Done = 2;
+
+		std::atomic<uint8_t> _state = Idle;
+	public:
+		OnceFlag() = default;
+
+		OnceFlag(const OnceFlag& other):
+			_state(other.IsDone() ? Done : Idle)
+		{}
+
+		OnceFlag& operator=(const OnceFlag& other)
+		{
+			_state.store(other.IsDone() ? Done : Idle, std::memory_order_release);
+			return *this;
+		}
+
+		bool IsDone() const
+		{
+			return _state.load(std::memory_order_acquire) == Done;
+		}
+
+		template<typename TFunc>
+		void Call(TFunc&& func)
+		{
+			if(IsDone())
+			{
+				return;
+			}
+
+			uint8_t expected = Idle;
+			while(!_state.compare_exchange_strong(expected, Running, std::memory_order_acquire))
+			{
+				if(expected == Done)
+				{
+					return;
+				}
+
+				_state.wait(Running, std::memory_order_acquire);
+				expected = Idle;
+			}
+
+			try
+			{
+				func();
+			}
+			catch(...)
+			{
+				_state.store(Idle, std::memory_order_release);
+				_state.notify_all();
+				throw;
+			}
+
+			_state.store(Done, std::memory_order_release);
+			_state.notify_all();
+		}
+	};
+
+	struct ThreadPoolOptions
+	{
+		size_t ThreadCount = 0;
+		std::vector<size_t> Affinity;
+	};
+
+	class ThreadPool
+	{
+	private:
+		using Task = std::function<void()>;
+
+		struct Worker
+		{
+			std::mutex Mutex;
+			std::deque<Task> Tasks;
+			std::thread Thread;
+		};
+
+		ThreadPoolOptions _options;
+		std::vector<std::unique_ptr<Worker>> _workers;
+		std::atomic<bool> _started = false;
+		std::mutex _startMutex;
+		std::atomic<size_t> _pending = 0;
+		std::atomic<size_t> _next = 0;
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+		bool _stopping = false;
+
+		static inline thread_local ThreadPool* _currentPool = nullptr;
+		static inline thread_local size_t _currentWorker = 0;
+	public:
+		explicit ThreadPool(ThreadPoolOptions options = {}):
+			_options(std::move(options))
+		{
+			if(_options.ThreadCount == 0)
+			{
+				_options.ThreadCount = HardwareConcurrency();
+			}
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		~ThreadPool()
+		{
+			Stop();
+		}
+
+		static ThreadPool& Default()
+		{
+			static ThreadPool pool;
+			return pool;
+		}
+
+		size_t Size() const
+		{
+			return _options.ThreadCount;
+		}
+
+		bool IsStarted() const
+		{
+			return _started.load(std::memory_order_acquire);
+		}
+
+		void Configure(ThreadPoolOptions options)
+		{
+			std::lock_guard lock(_startMutex);
+
+			if(IsStarted())
+			{
+				throw std::logic_error("Thread pool is already started");
+			}
+
+			_options = std::move(options);
+			if(_options.ThreadCount == 0)
+			{
+				_options.ThreadCount = HardwareConcurrency();
+			}
+		}
+
+		template<typename TFunc>
+		void Post(TFunc&& func)
+		{
+			EnsureStarted();
+
+			size_t index = _currentPool == this
+				? _currentWorker
+				: _next.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+
+			Worker& worker = *_workers[index];
+			{
+				std::lock_guard lock(worker.Mutex);
+				worker.Tasks.emplace_back(std::forward<TFunc>(func));
+				_pending.fetch_add(1, std::memory_order_release);
+			}
+
+			{
+				std::lock_guard lock(_sleepMutex);
+			}
+
+			_wake.notify_one();
+		}
+
+		bool TryRunPending()
+		{
+			if(!IsStarted())
+			{
+				return false;
+			}
+
+			size_t start = _currentPool == this ? _currentWorker : 0;
+			if(auto task = Steal(start))
+			{
+				(*task)();
+				return true;
+			}
+
+			return false;
+		}
+	private:
+		void Stop()
+		{
+			{
+				std::lock_guard lock(_sleepMutex);
+				_stopping = true;
+			}
+
+			_wake.notify_all();
+
+			for(auto& worker : _workers)
+			{
+				if(worker->Thread.joinable())
+				{
+					worker->Thread.join();
+				}
+			}
+		}
+
+		void EnsureStarted()
+		{
+			if(IsStarted())
+			{
+				return;
+			}
+
+			std::lock_guard lock(_startMutex);
+			if(IsStarted())
+			{
+				return;
+			}
+
+			std::vector<std::unique_ptr<Worker>> workers;
+			workers.reserve(_options.ThreadCount);
+			for(size_t i = 0; i < _options.ThreadCount; i++)
+			{
+				workers.push_back(std::make_unique<Worker>());
+			}
+
+			_workers = std::move(workers);
+			size_t started = 0;
+
+			try
+			{
+				for(; started < _options.ThreadCount; started++)
+				{
+					_workers[started]->Thread = std::thread([this, i = started] { Run(i); });
+
+					if(!_options.Affinity.empty())
+					{
+						Pin(_workers[started]->Thread, _options.Affinity[started % _options.Affinity.size()]);
+					}
+				}
+			}
+			catch(...)
+			{
+				Stop();
+				_workers.clear();
+
+				{
+					std::lock_guard lock(_sleepMutex);
+					_stopping = false;
+				}
+
+				throw;
+			}
+
+			_started.store(true, std::memory_order_release);
+		}
+
+		void Run(size_t index)
+		{
+			_currentPool = this;
+			_currentWorker = index;
+
+			while(true)
+			{
+				if(auto task = Pop(index))
+				{
+					(*task)();
+					continue;
+				}
+
+				std::unique_lock lock(_sleepMutex);
+				_wake.wait(lock, [this]
+				{
+					return _stopping || _pending.load(std::memory_order_acquire) != 0;
+				});
+
+				if(_stopping && _pending.load(std::memory_order_acquire) == 0)
+				{
+					return;
+				}
+			}
+		}
+
+		std::optional<Task> Pop(size_t index)
+		{
+			Worker& worker = *_workers[index];
+			{
+				std::lock_guard lock(worker.Mutex);
+				if(!worker.Tasks.empty())
+				{
+					Task task = std::move(worker.Tasks.back());
+					worker.Tasks.pop_back();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+			}
+
+			return Steal(index + 1);
+		}
+
+		std::optional<Task> Steal(size_t start)
+		{
+			for(size_t i = 0; i < _workers.size(); i++)
+			{
+				Worker& victim = *_workers[(start + i) % _workers.size()];
+
+				std::lock_guard lock(victim.Mutex);
+				if(!victim.Tasks.empty())
+				{
+					Task task = std::move(victim.Tasks.front());
+					victim.Tasks.pop_front();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		static void Pin([[maybe_unused]] std::thread& thread, [[maybe_unused]] size_t cpu)
+		{
+#if defined(__linux__)
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+			pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif
+		}
+	};
+
+	template<typename TFunc>
+	void ParallelFor(size_t count, TFunc&& func)
+	{
+		if(count == 0)
+		{
+			return;
+		}
+
+		if(count == 1)
+		{
+			func(size_t(0));
+			return;
+		}
+
+		ThreadPool& pool = ThreadPool::Default();
+		std::vector<std::exception_ptr> errors(count);
+		auto remaining = std::make_shared<std::atomic<size_t>>(count - 1);
+
+		auto run = [&](size_t i)
+		{
+			try
+			{
+				func(i);
+			}
+			catch(...)
+			{
+				errors[i] = std::current_exception();
+			}
+		};
+
+		size_t posted = 1;
+
+		try
+		{
+			for(; posted < count; posted++)
+			{
+				pool.Post([&run, remaining, i = posted]
+				{
+					run(i);
+
+					if(remaining->fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						remaining->notify_all();
+					}
+				});
+			}
+		}
+		catch(...)
+		{
+			for(size_t i = posted; i < count; i++)
+			{
+				run(i);
+			}
+
+			remaining->fetch_sub(count - posted, std::memory_order_acq_rel);
+		}
+
+		run(0);
+
+		for(size_t left; (left = remaining->load(std::memory_order_acquire)) != 0;)
+		{
+			if(!pool.TryRunPending())
+			{
+				remaining->wait(left, std::memory_order_acquire);
+			}
+		}
+
+		for(auto& error : errors)
+		{
+			if(error)
+			{
+				std::rethrow_exception(error);
+			}
+		}
+	}
+
+	template<typename TFunc>
+	auto MapChunks(size_t size, size_t concurrency, TFunc&& func)
+	{
+		using TResult = std::invoke_result_t<TFunc&, size_t, size_t>;
+
+		size_t count = ChunkCount(size, concurrency == 0 ? ThreadPool::Default().Size() : concurrency);
+		std::vector<std::optional<TResult>> slots(count);
+
+		ParallelFor(count, [&](size_t i)
+		{
+			slots[i].emplace(func(size * i / count, size * (i + 1) / count));
+		});
+
+		std::vector<TResult> results;
+		results.reserve(count);
+
+		for(auto& slot : slots)
+		{
+			results.push_back(std::move(*slot));
+		}
+
+		return results;
+	}
+
+	struct ReduceOptions
+	{
+		size_t ChunkSize = 0;
+		size_t Concurrency = 0;
+	};
+
+	template<typename TReduce, typename TCombine>
+	auto Reduce(size_t size, const ReduceOptions& options, TReduce&& reduce, TCombine&& combine)
+	{
+		using TResult = std::invoke_result_t<TReduce&, size_t, size_t>;
+
+		std::vector<TResult> partials;
+		if(options.ChunkSize == 0)
+		{
+			partials = MapChunks(size, options.Concurrency, reduce);
+		}
+		else
+		{
+			size_t count = std::max<size_t>(1, (size + options.ChunkSize - 1) / options.ChunkSize);
+			size_t groups = std::min(count, options.Concurrency == 0 ? ThreadPool::Default().Size() : options.Concurrency);
+			std::vector<std::optional<TResult>> slots(count);
+
+			ParallelFor(groups, [&](size_t group)
+			{
+				for(size_t i = count * group / groups; i < count * (group + 1) / groups; i++)
+				{
+					slots[i].emplace(reduce(i * options.ChunkSize, std::min(size, (i + 1) * options.ChunkSize)));
+				}
+			});
+
+			partials.reserve(count);
+			for(auto& slot : slots)
+			{
+				partials.push_back(std::move(*slot));
+			}
+		}
+
+		for(size_t width = 1; width < partials.size(); width *= 2)
+		{
+			for(size_t i = 0; i + width < partials.size(); i += 2 * width)
+			{
+				partials[i] = std::invoke(combine, std::move(partials[i]), std::move(partials[i + width]));
+			}
+		}
+
+		return std::move(partials.front());
+	}
+
+	template<typename TFunc>
+	void ForEachChunk(size_t size, size_t concurrency, TFunc&& func)
+	{
+		MapChunks(size, concurrency, [&func](size_t from, size_t to)
+		{
+			func(from, to);
+			return true;
+		});
+	}
+}
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Views.h"
+#include "Execution.h"
+#include "Simd.h"
+
+#include <atomic>
+#include <memory_resource>
 
 namespace Ranges::Adaptors
 {
@@ -15,6 +20,18 @@ namespace Ranges::Adaptors
 	using std::ranges::iterator_t;
 	using std::views::all_t;
 
+	template<typename TFirst, typename TSecond>
+	struct ComposedAdaptor;
+
+	template<typename TAdaptor>
+	struct RangeAdaptor;
+
+	template<typename T>
+	concept IsRangeAdaptor = std::is_base_of_v<RangeAdaptor<std::remove_cvref_t<T>>, std::remove_cvref_t<T>>;
+
+	template<typename T>
+	concept IsAdaptorClosure = IsRangeAdaptor<T> || (!range<T> && requires(T closure) { std::forward<T>(closure) | std::views::all; });
+
 	template<typename TAdaptor>
 	struct RangeAdaptor
 	{
@@ -25,12 +42,196 @@ namespace Ranges::Adaptors
 		}
 
 		template<range TRange>
-		constexpr friend decltype(auto) operator|(TRange&& range, RangeAdaptor&& adaptor)
+		constexpr friend decltype(auto) operator|(TRange&& range, const RangeAdaptor& adaptor)
 		{
 			return adaptor(std::forward<TRange>(range));
 		}
+
+		template<IsAdaptorClosure TFirst>
+		constexpr friend auto operator|(TFirst&& first, const RangeAdaptor& adaptor)
+		{
+			return ComposedAdaptor<std::decay_t<TFirst>, TAdaptor>(std::forward<TFirst>(first), static_cast<const TAdaptor&>(adaptor));
+		}
+
+		template<typename TSecond> requires (IsAdaptorClosure<TSecond> && !IsRangeAdaptor<TSecond>)
+		constexpr friend auto operator|(const RangeAdaptor& adaptor, TSecond&& second)
+		{
+			return ComposedAdaptor<TAdaptor, std::decay_t<TSecond>>(static_cast<const TAdaptor&>(adaptor), std::forward<TSecond>(second));
+		}
+	};
+
+	template<typename TFirst, typename TSecond>
+	struct ComposedAdaptor : public RangeAdaptor<ComposedAdaptor<TFirst, TSecond>>
+	{
+		TFirst First;
+		TSecond Second;
+
+		constexpr ComposedAdaptor(TFirst first, TSecond second):
+			First(std::move(first)),
+			Second(std::move(second))
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			return Second(First(std::forward<TRange>(range)));
+		}
+	};
+
+	template<typename TRange>
+	concept ParallelRange = 
+		std::ranges::random_access_range<TRange> &&
+		sized_range<TRange> &&
+		Views::IsParallelView<std::remove_cvref_t<TRange>>;
+
+	template<typename TAccumulator, ParallelRange TRange> requires Simd::ContiguousArithmeticRange<TRange>
+	TAccumulator ParallelReproducibleSum(TRange&& range)
+	{
+		auto data = std::ranges::data(range);
+		Execution::ReduceOptions options = { .ChunkSize = Simd::ReproducibleBlockSize, .Concurrency = range.Concurrency() };
+
+		return Execution::Reduce(std::ranges::size(range), options, [data](size_t from, size_t to)
+		{
+			return Simd::SumLanes<TAccumulator>(data + from, to - from);
+		}, std::plus<>());
+	}
+
+	template<typename TAllocator>
+	concept AllocatorSource =
+		std::is_convertible_v<TAllocator, std::pmr::memory_resource*> ||
+		requires(TAllocator allocator)
+		{
+			typename TAllocator::value_type;
+			allocator.deallocate(allocator.allocate(1), 1);
+		};
+
+	template<AllocatorSource TAllocator>
+	constexpr auto MakeAllocator(TAllocator allocator)
+	{
+		if constexpr(std::is_convertible_v<TAllocator, std::pmr::memory_resource*>)
+		{
+			return std::pmr::polymorphic_allocator<std::byte>(allocator);
+		}
+		else
+		{
+			return Sorting::ReboundAllocator<TAllocator, std::byte>(allocator);
+		}
+	}
+
+	template<ParallelRange TRange, typename TPredicate>
+	bool ParallelAnyOf(TRange&& range, const TPredicate& predicate)
+	{
+		std::atomic<bool> found = false;
+		auto first = std::ranges::begin(range);
+
+		Execution::ForEachChunk(std::ranges::size(range), range.Concurrency(), [&](size_t from, size_t to)
+		{
+			auto it = first + static_cast<range_difference_t<TRange>>(from);
+			for(; from < to && !found.load(std::memory_order_relaxed); ++from, ++it)
+			{
+				if(predicate(*it))
+				{
+					found.store(true, std::memory_order_relaxed);
+				}
+			}
+		});
+
+		return found.load();
+	}
+
+	template<typename TRange, typename TProjection>
+	using ProjectedKey = std::invoke_result_t<const TProjection&, range_reference_t<TRange>>;
+
+	template<typename TRange, typename TProjection>
+	class KeyCache
+	{
+	private:
+		using TKey = std::remove_cvref_t<ProjectedKey<TRange, TProjection>>;
+
+		static constexpr bool ByReference =
+			std::ranges::forward_range<TRange> &&
+			std::is_lvalue_reference_v<range_reference_t<TRange>> &&
+			std::is_lvalue_reference_v<ProjectedKey<TRange, TProjection>>;
+
+		std::conditional_t<ByReference, const TKey*, std::optional<TKey>> _key {};
+	public:
+		using Projected = std::conditional_t<std::is_lvalue_reference_v<range_reference_t<TRange>>,
+											 ProjectedKey<TRange, TProjection>, TKey>;
+
+		template<typename TItem>
+		static constexpr Projected Project(const TProjection& projection, TItem&& item)
+		{
+			return std::invoke(projection, std::forward<TItem>(item));
+		}
+
+		template<typename TValue>
+		constexpr void Store(TValue&& key)
+		{
+			if constexpr(ByReference)
+			{
+				_key = std::addressof(key);
+			}
+			else
+			{
+				_key = std::forward<TValue>(key);
+			}
+		}
+
+		constexpr const TKey& Get() const
+		{
+			return *_key;
+		}
 	};
 
+	template<typename TComparer, std::ranges::forward_range TRange, typename TProjection>
+	constexpr auto FindExtremum(TRange&& range, const TProjection& projection)
+	{
+		auto it = std::ranges::begin(range);
+		auto end = std::ranges::end(range);
+
+		if(it == end)
+		{
+			throw std::runtime_error("Range is empty");
+		}
+
+		TComparer comparer;
+		KeyCache<TRange, TProjection> best;
+		best.Store(best.Project(projection, *it));
+		auto bestIt = it;
+		size_t bestIndex = 0;
+
+		for(size_t i = 1; ++it != end; i++)
+		{
+			decltype(auto) key = best.Project(projection, *it);
+
+			if(comparer(key, best.Get()))
+			{
+				best.Store(std::forward<decltype(key)>(key));
+				bestIt = it;
+				bestIndex = i;
+			}
+		}
+
+		return std::pair(bestIt, bestIndex);
+	}
+
+	template<typename TFunc, typename TAccumulate, typename TItem>
+	constexpr void Accumulate(const TFunc& func, TAccumulate& accumulate, TItem&& item)
+	{
+		if constexpr(std::is_void_v<std::invoke_result_t<const TFunc&, TAccumulate&, TItem>>)
+		{
+			std::invoke(func, accumulate, std::forward<TItem>(item));
+		}
+		else if constexpr(std::is_invocable_v<const TFunc&, TAccumulate&&, TItem>)
+		{
+			accumulate = std::invoke(func, std::move(accumulate), std::forward<TItem>(item));
+		}
+		else
+		{
+			accumulate = std::invoke(func, accumulate, std::forward<TItem>(item));
+		}
+	}
+
 	template<typename TFunc>
 	struct AggregateAdaptor : public RangeAdaptor<AggregateAdaptor<TFunc>>
 	{
@@ -46,7 +247,42 @@ namespace Ranges::Adaptors
 			range_value_t<TRange> result = {};
 			for(const auto& item : range)
 			{
-				result = Function(result, item);
+				Accumulate(Function, result, item);
+			}
+
+			return result;
+		}
+
+		template<ParallelRange TRange>
+		auto operator()(TRange&& range) const
+		{
+			using T = range_value_t<TRange>;
+
+			auto first = std::ranges::begin(range);
+			auto partials = Execution::MapChunks(std::ranges::size(range), range.Concurrency(), [&](size_t from, size_t to)
+			{
+				auto it = first + static_cast<range_difference_t<TRange>>(from);
+				std::optional<T> partial;
+
+				if(from < to)
+				{
+					partial = *it;
+					for(++it, ++from; from < to; ++from, ++it)
+					{
+						Accumulate(Function, *partial, *it);
+					}
+				}
+
+				return partial;
+			});
+
+			T result = {};
+			for(auto& partial : partials)
+			{
+				if(partial)
+				{
+					Accumulate(Function, result, std::move(*partial));
+				}
 			}
 
 			return result;
@@ -70,13 +306,55 @@ namespace Ranges::Adaptors
 			TAccumulate result = Seed;
 			for(const auto& item : range)
 			{
-				result = Function(result, item);
+				Accumulate(Function, result, item);
 			}
 
 			return result;
 		}
 	};
 
+	template<typename TFunc, typename TCombine, typename TAccumulate>
+	struct AggregateParallelAdaptor : public RangeAdaptor<AggregateParallelAdaptor<TFunc, TCombine, TAccumulate>>
+	{
+		TFunc Function;
+		TCombine Combine;
+		TAccumulate Seed;
+		Execution::ReduceOptions Options;
+
+		constexpr AggregateParallelAdaptor(TFunc func, TCombine combine, const TAccumulate& seed, Execution::ReduceOptions options):
+			Function(std::move(func)),
+			Combine(std::move(combine)),
+			Seed(seed),
+			Options(options)
+		{}
+
+		template<std::ranges::random_access_range TRange> requires sized_range<TRange>
+		TAccumulate operator()(TRange&& range) const
+		{
+			Execution::ReduceOptions options = Options;
+			if constexpr(Views::IsParallelView<std::remove_cvref_t<TRange>>)
+			{
+				if(options.Concurrency == 0)
+				{
+					options.Concurrency = range.Concurrency();
+				}
+			}
+
+			auto first = std::ranges::begin(range);
+			return Execution::Reduce(std::ranges::size(range), options, [&](size_t from, size_t to)
+			{
+				TAccumulate partial = Seed;
+				auto it = first + static_cast<range_difference_t<TRange>>(from);
+				for(; from < to; ++from, ++it)
+				{
+					Accumulate(Function, partial, *it);
+				}
+
+				return partial;
+			}, Combine);
+		}
+	};
+
 	template<typename TPredicate>
 	struct AllAdaptor : public RangeAdaptor<AllAdaptor<TPredicate>>
 	{
@@ -99,6 +377,15 @@ namespace Ranges::Adaptors
 
 			return true;
 		}
+
+		template<ParallelRange TRange>
+		bool operator()(TRange&& range) const
+		{
+			return !ParallelAnyOf(std::forward<TRange>(range), [this](const auto& item)
+			{
+				return !Predicate(item);
+			});
+		}
 	};
 
 	template<typename TPredicate>
@@ -123,6 +410,12 @@ namespace Ranges::Adaptors
 
 			return false;
 		}
+
+		template<ParallelRange TRange>
+		bool operator()(TRange&& range) const
+		{
+			return ParallelAnyOf(std::forward<TRange>(range), Predicate);
+		}
 	};
 
 	template<typename TValue>
@@ -141,19 +434,93 @@ namespace Ranges::Adaptors
 		}
 	};
 
+	template<typename TProjection = std::identity>
+	struct ArgMaxAdaptor : public RangeAdaptor<ArgMaxAdaptor<TProjection>>
+	{
+		TProjection Projection;
+
+		constexpr ArgMaxAdaptor(TProjection projection = {}):
+			Projection(std::move(projection))
+		{}
+
+		template<std::ranges::forward_range TRange>
+		constexpr size_t operator()(TRange&& range) const
+		{
+			return FindExtremum<std::ranges::greater>(range, Projection).second;
+		}
+	};
+
+	template<typename TProjection = std::identity>
+	struct ArgMinAdaptor : public RangeAdaptor<ArgMinAdaptor<TProjection>>
+	{
+		TProjection Projection;
+
+		constexpr ArgMinAdaptor(TProjection projection = {}):
+			Projection(std::move(projection))
+		{}
+
+		template<std::ranges::forward_range TRange>
+		constexpr size_t operator()(TRange&& range) const
+		{
+			return FindExtremum<std::ranges::less>(range, Projection).second;
+		}
+	};
+
 	struct AverageAdaptor : public RangeAdaptor<AverageAdaptor>
 	{
+		Simd::Summation Summation;
+
+		constexpr explicit AverageAdaptor(Simd::Summation summation = Simd::Summation::Naive):
+			Summation(summation)
+		{}
+
 		template<range TRange>
 		constexpr double operator()(TRange&& range) const
 		{
 			double sum = 0;
+			size_t count = 0;
 
-			for(const auto& item : range)
+			if constexpr(Simd::ContiguousArithmeticRange<TRange> && std::is_integral_v<range_value_t<TRange>> &&
+						 sizeof(range_value_t<TRange>) < sizeof(Simd::SumResult<range_value_t<TRange>>))
+			{
+				using TAccumulator = Simd::SumResult<range_value_t<TRange>>;
+
+				count = std::ranges::size(range);
+				sum = static_cast<double>(Simd::Sum<TAccumulator>(std::ranges::data(range), count));
+			}
+			else if constexpr(Simd::ContiguousArithmeticRange<TRange>)
 			{
-				sum += item;
+				count = std::ranges::size(range);
+
+				if constexpr(ParallelRange<TRange>)
+				{
+					sum = Summation == Simd::Summation::Reproducible
+						? ParallelReproducibleSum<double>(range)
+						: Simd::Sum<double>(std::ranges::data(range), count, Summation);
+				}
+				else
+				{
+					sum = Simd::Sum<double>(std::ranges::data(range), count, Summation);
+				}
 			}
+			else
+			{
+				Simd::Summator<double> summator(Summation);
+				for(const auto& item : range)
+				{
+					summator.Add(item);
+					count++;
+				}
 
-			return sum / std::ranges::distance(range);
+				sum = summator.Result();
+			}
+
+			if(count == 0)
+			{
+				throw std::runtime_error("Range is empty");
+			}
+
+			return sum / count;
 		}
 	};
 
@@ -203,15 +570,55 @@ namespace Ranges::Adaptors
 		constexpr bool operator()(TRange&& range) const
 			requires std::convertible_to<range_value_t<TRange>, T>
 		{
-			for(const auto& item : range)
+			if constexpr(Simd::ContiguousArithmeticRange<TRange> && Simd::Searchable<range_value_t<TRange>, T>)
 			{
-				if(item == Value)
+				return Simd::Contains(std::ranges::data(range), std::ranges::size(range), Value);
+			}
+			else
+			{
+				for(const auto& item : range)
 				{
-					return true;
+					if(item == Value)
+					{
+						return true;
+					}
 				}
+
+				return false;
 			}
+		}
 
-			return false;
+		template<ParallelRange TRange>
+		bool operator()(TRange&& range) const
+			requires std::convertible_to<range_value_t<TRange>, T>
+		{
+			if constexpr(Simd::ContiguousArithmeticRange<TRange> && Simd::Searchable<range_value_t<TRange>, T>)
+			{
+				constexpr size_t BlockSize = 1 << 16;
+
+				std::atomic<bool> found = false;
+				auto data = std::ranges::data(range);
+
+				Execution::ForEachChunk(std::ranges::size(range), range.Concurrency(), [&](size_t from, size_t to)
+				{
+					for(; from < to && !found.load(std::memory_order_relaxed); from += BlockSize)
+					{
+						if(Simd::Contains(data + from, std::min(BlockSize, to - from), Value))
+						{
+							found.store(true, std::memory_order_relaxed);
+						}
+					}
+				});
+
+				return found.load();
+			}
+			else
+			{
+				return ParallelAnyOf(std::forward<TRange>(range), [this](const auto& item)
+				{
+					return item == Value;
+				});
+			}
 		}
 	};
 
@@ -235,15 +642,22 @@ namespace Ranges::Adaptors
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
-			auto it = range.begin();
-			std::ranges::advance(it, Position, range.end());
-
-			if(it == range.end())
+			if constexpr(Views::IsOrderedView<std::remove_cvref_t<TRange>>)
 			{
-				throw std::out_of_range("Position is out of range");
+				return range.ElementAt(Position);
 			}
+			else
+			{
+				auto it = range.begin();
+				std::ranges::advance(it, Position, range.end());
+
+				if(it == range.end())
+				{
+					throw std::out_of_range("Position is out of range");
+				}
 
-			return *it;			
+				return *it;
+			}
 		}
 	};
 
@@ -277,12 +691,26 @@ namespace Ranges::Adaptors
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
-			if(std::ranges::begin(range) == std::ranges::end(range))
+			if constexpr(Views::IsOrderedView<std::remove_cvref_t<TRange>> &&
+				(!std::is_lvalue_reference_v<TRange> || std::copyable<std::remove_cvref_t<TRange>>))
 			{
-				throw std::runtime_error("Range is empty");
+				auto top = std::forward<TRange>(range).Take(1);
+				if(top.begin() == top.end())
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				return *top.begin();
+			}
+			else
+			{
+				if(std::ranges::begin(range) == std::ranges::end(range))
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				return *std::ranges::begin(range);
 			}
-			
-			return *std::ranges::begin(range);
 		}
 	};
 
@@ -496,6 +924,26 @@ namespace Ranges::Adaptors
 		}
 	};
 
+	template<template<typename> typename TComparer, typename TProjection = std::identity>
+	struct LiveOrderAdaptor : public RangeAdaptor<LiveOrderAdaptor<TComparer, TProjection>>
+	{
+		TProjection Projection;
+		Sorting::SortOptions Options;
+
+		constexpr LiveOrderAdaptor(TProjection projection = {}, Sorting::SortOptions options = {}):
+			Projection(std::move(projection)),
+			Options(options)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			using T = std::decay_t<std::invoke_result_t<TProjection, range_value_t<TRange>>>;
+
+			return Views::LiveOrderedView(std::forward<TRange>(range), TComparer<T>(), Projection, Options);
+		}
+	};
+
 	template<typename TProjection = std::identity>
 	struct MaxAdaptor : public RangeAdaptor<MaxAdaptor<TProjection>>
 	{
@@ -508,7 +956,38 @@ namespace Ranges::Adaptors
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
-			return std::ranges::max(std::forward<TRange>(range), {}, Projection);
+			if constexpr(std::is_same_v<TProjection, std::identity> && Simd::ContiguousArithmeticRange<TRange> &&
+						 std::is_integral_v<range_value_t<TRange>>)
+			{
+				if(std::ranges::empty(range))
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				return Simd::MinMax(std::ranges::data(range), std::ranges::size(range)).max;
+			}
+			else if constexpr(!std::is_same_v<TProjection, std::identity> && std::ranges::forward_range<TRange>)
+			{
+				return range_value_t<TRange>(*FindExtremum<std::ranges::greater>(range, Projection).first);
+			}
+			else
+			{
+				return std::ranges::max(std::forward<TRange>(range), {}, Projection);
+			}
+		}
+
+		template<ParallelRange TRange>
+		auto operator()(TRange&& range) const
+		{
+			auto first = std::ranges::begin(range);
+			auto partials = Execution::MapChunks(std::ranges::size(range), range.Concurrency(), [&](size_t from, size_t to)
+			{
+				return std::ranges::max(std::ranges::subrange(
+					first + static_cast<range_difference_t<TRange>>(from),
+					first + static_cast<range_difference_t<TRange>>(to)), {}, Projection);
+			});
+
+			return std::ranges::max(partials, {}, Projection);
 		}
 	};
 
@@ -524,36 +1003,320 @@ namespace Ranges::Adaptors
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
-			return std::ranges::min(std::forward<TRange>(range), {}, Projection);
+			if constexpr(std::is_same_v<TProjection, std::identity> && Simd::ContiguousArithmeticRange<TRange> &&
+						 std::is_integral_v<range_value_t<TRange>>)
+			{
+				if(std::ranges::empty(range))
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				return Simd::MinMax(std::ranges::data(range), std::ranges::size(range)).min;
+			}
+			else if constexpr(!std::is_same_v<TProjection, std::identity> && std::ranges::forward_range<TRange>)
+			{
+				return range_value_t<TRange>(*FindExtremum<std::ranges::less>(range, Projection).first);
+			}
+			else
+			{
+				return std::ranges::min(std::forward<TRange>(range), {}, Projection);
+			}
+		}
+
+		template<ParallelRange TRange>
+		auto operator()(TRange&& range) const
+		{
+			auto first = std::ranges::begin(range);
+			auto partials = Execution::MapChunks(std::ranges::size(range), range.Concurrency(), [&](size_t from, size_t to)
+			{
+				return std::ranges::min(std::ranges::subrange(
+					first + static_cast<range_difference_t<TRange>>(from),
+					first + static_cast<range_difference_t<TRange>>(to)), {}, Projection);
+			});
+
+			return std::ranges::min(partials, {}, Projection);
+		}
+	};
+
+	template<typename TProjection = std::identity>
+	struct MinMaxAdaptor : public RangeAdaptor<MinMaxAdaptor<TProjection>>
+	{
+		TProjection Projection;
+
+		constexpr MinMaxAdaptor(TProjection projection = {}):
+			Projection(std::move(projection))
+		{}
+
+		template<std::ranges::forward_range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			using T = range_value_t<TRange>;
+
+			if constexpr(std::is_same_v<TProjection, std::identity> && Simd::ContiguousArithmeticRange<TRange>)
+			{
+				if(std::ranges::empty(range))
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				return Simd::MinMax(std::ranges::data(range), std::ranges::size(range));
+			}
+			else
+			{
+				auto it = std::ranges::begin(range);
+				auto end = std::ranges::end(range);
+
+				if(it == end)
+				{
+					throw std::runtime_error("Range is empty");
+				}
+
+				KeyCache<TRange, TProjection> minKey;
+				KeyCache<TRange, TProjection> maxKey;
+				decltype(auto) firstKey = minKey.Project(Projection, *it);
+				minKey.Store(firstKey);
+				maxKey.Store(std::forward<decltype(firstKey)>(firstKey));
+				auto minIt = it;
+				auto maxIt = it;
+
+				while(++it != end)
+				{
+					decltype(auto) key = minKey.Project(Projection, *it);
+
+					if(key < minKey.Get())
+					{
+						minKey.Store(key);
+						minIt = it;
+					}
+
+					if(!(key < maxKey.Get()))
+					{
+						maxKey.Store(std::forward<decltype(key)>(key));
+						maxIt = it;
+					}
+				}
+
+				return std::ranges::minmax_result<T> { T(*minIt), T(*maxIt) };
+			}
+		}
+	};
+
+	template<template<typename> typename TComparer, typename TProjection = std::identity, bool Indirect = false, typename TAllocator = std::allocator<std::byte>>
+	struct OrderAdaptor : public RangeAdaptor<OrderAdaptor<TComparer, TProjection, Indirect, TAllocator>>
+	{
+		TProjection Projection;
+		Sorting::SortOptions Options;
+		[[no_unique_address]] TAllocator Allocator;
+
+		constexpr OrderAdaptor(TProjection projection = {}, Sorting::SortOptions options = {}, TAllocator allocator = {}):
+			Projection(std::move(projection)),
+			Options(options),
+			Allocator(std::move(allocator))
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			using T = std::decay_t<std::invoke_result_t<TProjection, range_value_t<TRange>>>;
+
+			Sorting::SortOptions options = Options;
+			if constexpr(Views::IsParallelView<std::remove_cvref_t<TRange>>)
+			{
+				options.Parallel = true;
+				options.Concurrency = range.Concurrency();
+			}
+
+			if constexpr(Indirect || !std::copyable<range_value_t<TRange>>)
+			{
+				return Views::IndirectOrderedView(std::forward<TRange>(range), TComparer<T>(), Projection, options, Allocator);
+			}
+			else
+			{
+				return Views::OrderedView(std::forward<TRange>(range), TComparer<T>(), Projection, options, Allocator);
+			}
+		}
+	};
+
+	template<template<typename> typename TComparer, typename TProjection = std::identity>
+	struct ExternalOrderAdaptor : public RangeAdaptor<ExternalOrderAdaptor<TComparer, TProjection>>
+	{
+		TProjection Projection;
+		Sorting::ExternalSortOptions Options;
+
+		constexpr ExternalOrderAdaptor(TProjection projection, Sorting::ExternalSortOptions options):
+			Projection(std::move(projection)),
+			Options(options)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			using T = std::decay_t<std::invoke_result_t<TProjection, range_value_t<TRange>>>;
+
+			return Views::ExternalOrderedView(std::forward<TRange>(range), TComparer<T>(), Projection, Options);
+		}
+	};
+
+	struct ParallelAdaptor : public RangeAdaptor<ParallelAdaptor>
+	{
+		size_t Concurrency;
+
+		constexpr explicit ParallelAdaptor(size_t concurrency):
+			Concurrency(concurrency)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			return Views::ParallelView(std::forward<TRange>(range), Concurrency);
+		}
+	};
+
+	struct SliceAdaptor : public RangeAdaptor<SliceAdaptor>
+	{
+		size_t Start;
+		size_t Count;
+
+		constexpr SliceAdaptor(size_t start, size_t count):
+			Start(start),
+			Count(count)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			if constexpr(Views::IsOrderedView<std::remove_cvref_t<TRange>>)
+			{
+				return std::views::drop(std::forward<TRange>(range).Take(Count > SIZE_MAX - Start ? SIZE_MAX : Start + Count), Start);
+			}
+			else
+			{
+				return std::views::take(std::views::drop(std::forward<TRange>(range), Start), Count);
+			}
+		}
+	};
+
+	template<typename TProjection = std::identity>
+	struct SumAdaptor : public RangeAdaptor<SumAdaptor<TProjection>>
+	{
+		TProjection Projection;
+		Simd::Summation Summation;
+
+		constexpr SumAdaptor(TProjection projection = {}, Simd::Summation summation = Simd::Summation::Naive):
+			Projection(std::move(projection)),
+			Summation(summation)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			using TValue = std::decay_t<std::invoke_result_t<const TProjection&, range_reference_t<TRange>>>;
+			using TResult = Simd::SumResult<TValue>;
+
+			if constexpr(std::is_same_v<TProjection, std::identity> && Simd::ContiguousArithmeticRange<TRange>)
+			{
+				if constexpr(ParallelRange<TRange> && std::is_floating_point_v<TResult>)
+				{
+					if(Summation == Simd::Summation::Reproducible)
+					{
+						return ParallelReproducibleSum<TResult>(range);
+					}
+				}
+
+				return Simd::Sum<TResult>(std::ranges::data(range), std::ranges::size(range), Summation);
+			}
+			else if constexpr(std::is_arithmetic_v<TResult>)
+			{
+				Simd::Summator<TResult> summator(Summation);
+				for(auto&& item : range)
+				{
+					summator.Add(static_cast<TResult>(std::invoke(Projection, item)));
+				}
+
+				return summator.Result();
+			}
+			else
+			{
+				TResult result = {};
+				for(auto&& item : range)
+				{
+					result = std::move(result) + std::invoke(Projection, item);
+				}
+
+				return result;
+			}
+		}
+	};
+
+	struct TakeAdaptor : public RangeAdaptor<TakeAdaptor>
+	{
+		size_t Count;
+
+		constexpr explicit TakeAdaptor(size_t count):
+			Count(count)
+		{}
+
+		template<range TRange>
+		constexpr auto operator()(TRange&& range) const
+		{
+			if constexpr(Views::IsOrderedView<std::remove_cvref_t<TRange>>)
+			{
+				return std::forward<TRange>(range).Take(Count);
+			}
+			else
+			{
+				return std::views::take(std::forward<TRange>(range), Count);
+			}
 		}
 	};
 
 	template<template<typename> typename TComparer, typename TProjection = std::identity>
-	struct OrderAdaptor : public RangeAdaptor<OrderAdaptor<TComparer, TProjection>>
+	struct TopAdaptor : public RangeAdaptor<TopAdaptor<TComparer, TProjection>>
 	{
+		size_t Count;
 		TProjection Projection;
 
-		constexpr OrderAdaptor(TProjection projection = {}):
+		constexpr TopAdaptor(size_t count, TProjection projection = {}):
+			Count(count),
 			Projection(std::move(projection))
 		{}
 
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
+		{
+			return OrderAdaptor<TComparer, TProjection>(Projection)(std::forward<TRange>(range)).Take(Count);
+		}
+	};
+
+	template<template<typename> typename TComparer, typename TProjection>
+	struct ThenAdaptor : public RangeAdaptor<ThenAdaptor<TComparer, TProjection>>
+	{
+		TProjection Projection;
+
+		constexpr explicit ThenAdaptor(TProjection projection):
+			Projection(std::move(projection))
+		{}
+
+		template<range TRange> requires Views::IsOrderedView<std::remove_cvref_t<TRange>>
+		constexpr auto operator()(TRange&& range) const
 		{
 			using T = std::decay_t<std::invoke_result_t<TProjection, range_value_t<TRange>>>;
-			return Views::OrderedView(std::forward<TRange>(range), TComparer<T>(), Projection);
+
+			return std::forward<TRange>(range).ThenBy(TComparer<T>(), Projection);
 		}
 	};
 
-	template<typename TKeySelector, typename TElementSelector>
-	struct ToUnorderedMapAdaptor: public RangeAdaptor<ToUnorderedMapAdaptor<TKeySelector, TElementSelector>>
+	template<typename TKeySelector, typename TElementSelector, typename TAllocator = std::allocator<std::byte>>
+	struct ToUnorderedMapAdaptor: public RangeAdaptor<ToUnorderedMapAdaptor<TKeySelector, TElementSelector, TAllocator>>
 	{
 		TKeySelector KeySelector;
 		TElementSelector ElementSelector;
+		[[no_unique_address]] TAllocator Allocator;
 
-		constexpr ToUnorderedMapAdaptor(TKeySelector keySelector, TElementSelector elementSelector):
+		constexpr ToUnorderedMapAdaptor(TKeySelector keySelector, TElementSelector elementSelector, TAllocator allocator = {}):
 			KeySelector(std::move(keySelector)),
-			ElementSelector(std::move(elementSelector))
+			ElementSelector(std::move(elementSelector)),
+			Allocator(std::move(allocator))
 		{}
 
 		template<range TRange>
@@ -563,7 +1326,10 @@ namespace Ranges::Adaptors
 			using TKey = std::decay_t<std::invoke_result_t<TKeySelector, T>>;
 			using TElement = std::decay_t<std::invoke_result_t<TElementSelector, T>>;
 
-			std::unordered_map<TKey, TElement> map;
+			using TMapAllocator = Sorting::ReboundAllocator<TAllocator, std::pair<const TKey, TElement>>;
+
+			TMapAllocator allocator(Allocator);
+			std::unordered_map<TKey, TElement, std::hash<TKey>, std::equal_to<TKey>, TMapAllocator> map(allocator);
 
 			for(const T& item : range)
 			{				
@@ -577,30 +1343,176 @@ namespace Ranges::Adaptors
 		}
 	};
 
-	template<typename TSelector>
-	struct ToUnorderedMapAdaptor2: public RangeAdaptor<ToUnorderedMapAdaptor2<TSelector>>
+	template<typename TSelector, typename TAllocator = std::allocator<std::byte>>
+	struct ToUnorderedMapAdaptor2: public RangeAdaptor<ToUnorderedMapAdaptor2<TSelector, TAllocator>>
 	{
 		TSelector Selector;
+		[[no_unique_address]] TAllocator Allocator;
 
-		constexpr explicit ToUnorderedMapAdaptor2(TSelector selector):
-			Selector(std::move(selector))
+		constexpr explicit ToUnorderedMapAdaptor2(TSelector selector, TAllocator allocator = {}):
+			Selector(std::move(selector)),
+			Allocator(std::move(allocator))
 		{}
 
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
 			auto seleted = range | std::views::transform(Selector);
-			return std::unordered_map(std::ranges::begin(seleted), std::ranges::end(seleted));
+
+			if constexpr(std::same_as<TAllocator, std::allocator<std::byte>>)
+			{
+				return std::unordered_map(std::ranges::begin(seleted), std::ranges::end(seleted));
+			}
+			else
+			{
+				using TPair = range_value_t<decltype(seleted)>;
+				using TKey = std::remove_const_t<typename TPair::first_type>;
+				using TElement = typename TPair::second_type;
+				using TMapAllocator = Sorting::ReboundAllocator<TAllocator, std::pair<const TKey, TElement>>;
+
+				return std::unordered_map<TKey, TElement, std::hash<TKey>, std::equal_to<TKey>, TMapAllocator>(
+					std::ranges::begin(seleted),
+					std::ranges::end(seleted),
+					0,
+					std::hash<TKey>(),
+					std::equal_to<TKey>(),
+					TMapAllocator(Allocator));
+			}
 		}
 	};
 
-	template<template<typename...> typename TContainer>
-	struct ToAdaptor : public RangeAdaptor<ToAdaptor<TContainer>>
+	template<typename TRange>
+	constexpr bool IsOwningView = false;
+
+	template<typename TRange>
+	constexpr bool IsOwningView<std::ranges::owning_view<TRange>> = true;
+
+	template<typename TRange, typename TContainer>
+	constexpr bool IsOwningViewOf = false;
+
+	template<typename TContainer>
+	constexpr bool IsOwningViewOf<std::ranges::owning_view<TContainer>, TContainer> = true;
+
+	template<template<typename...> typename TContainer, typename TAllocator = std::allocator<std::byte>>
+	struct ToAdaptor : public RangeAdaptor<ToAdaptor<TContainer, TAllocator>>
 	{
+		[[no_unique_address]] TAllocator Allocator;
+
+		constexpr explicit ToAdaptor(TAllocator allocator = {}):
+			Allocator(std::move(allocator))
+		{}
+
 		template<range TRange>
 		constexpr auto operator()(TRange&& range) const
 		{
-			return TContainer(std::ranges::begin(range), std::ranges::end(range));
+			using TSource = std::remove_cvref_t<TRange>;
+			using TResult = typename decltype(Deduce<range_value_t<TRange>>())::type;
+
+			constexpr bool Move = !std::is_lvalue_reference_v<TRange> && (!view<TSource> || IsOwningView<TSource>);
+
+			if constexpr(Move && std::same_as<TResult, TSource>)
+			{
+				return TResult(std::move(range));
+			}
+			else if constexpr(Move && IsOwningViewOf<TSource, TResult>)
+			{
+				return TResult(std::move(range).base());
+			}
+			else if constexpr(std::ranges::common_range<TRange> && std::ranges::forward_range<TRange> && Move)
+			{
+				return Make<TResult>(std::make_move_iterator(std::ranges::begin(range)), std::make_move_iterator(std::ranges::end(range)));
+			}
+			else if constexpr(std::ranges::common_range<TRange> && std::ranges::forward_range<TRange>)
+			{
+				return Make<TResult>(std::ranges::begin(range), std::ranges::end(range));
+			}
+			else
+			{
+				TResult result = MakeEmpty<TResult>();
+
+				if constexpr(requires { result.reserve(size_t()); })
+				{
+					if constexpr(sized_range<TRange>)
+					{
+						result.reserve(static_cast<size_t>(std::ranges::size(range)));
+					}
+					else if constexpr(std::ranges::forward_range<TRange>)
+					{
+						result.reserve(static_cast<size_t>(std::ranges::distance(range)));
+					}
+				}
+
+				for(auto it = std::ranges::begin(range); it != std::ranges::end(range); ++it)
+				{
+					if constexpr(Move)
+					{
+						result.insert(result.end(), std::ranges::iter_move(it));
+					}
+					else
+					{
+						result.insert(result.end(), *it);
+					}
+				}
+
+				return result;
+			}
+		}
+	private:
+		template<typename T>
+		static constexpr auto Deduce()
+		{
+			using TDefault = decltype(TContainer(std::declval<T*>(), std::declval<T*>()));
+
+			if constexpr(std::same_as<TAllocator, std::allocator<std::byte>>)
+			{
+				return std::type_identity<TDefault>();
+			}
+			else
+			{
+				using TItemAllocator = Sorting::ReboundAllocator<TAllocator, typename TDefault::value_type>;
+
+				if constexpr(IsHashed<TDefault>)
+				{
+					return std::type_identity<decltype(TContainer(std::declval<T*>(), std::declval<T*>(), size_t(), std::declval<TItemAllocator>()))>();
+				}
+				else
+				{
+					return std::type_identity<decltype(TContainer(std::declval<T*>(), std::declval<T*>(), std::declval<TItemAllocator>()))>();
+				}
+			}
+		}
+
+		template<typename TResult>
+		static constexpr bool IsHashed = requires { typename TResult::hasher; };
+
+		template<typename TResult, typename TIterator>
+		constexpr TResult Make(TIterator first, TIterator last) const
+		{
+			if constexpr(std::same_as<TAllocator, std::allocator<std::byte>>)
+			{
+				return TResult(std::move(first), std::move(last));
+			}
+			else if constexpr(IsHashed<TResult>)
+			{
+				return TResult(std::move(first), std::move(last), 0, typename TResult::allocator_type(Allocator));
+			}
+			else
+			{
+				return TResult(std::move(first), std::move(last), typename TResult::allocator_type(Allocator));
+			}
+		}
+
+		template<typename TResult>
+		constexpr TResult MakeEmpty() const
+		{
+			if constexpr(std::same_as<TAllocator, std::allocator<std::byte>>)
+			{
+				return TResult();
+			}
+			else
+			{
+				return TResult(typename TResult::allocator_type(Allocator));
+			}
 		}
 	};
 }
\ No newline at end of file
@@ -4,18 +4,34 @@
 
 namespace Ranges
 {
+	using Execution::ReduceOptions;
+	using Simd::Summation;
+	using Sorting::ExternalSortOptions;
+	using Sorting::SortOptions;
+
 	template<typename TFunc>
 	constexpr auto Aggregate(TFunc&& func)
 	{
-		return Adaptors::AggregateAdaptor<TFunc>(std::forward<TFunc>(func));
+		return Adaptors::AggregateAdaptor<std::decay_t<TFunc>>(std::forward<TFunc>(func));
 	}
 
 	template<typename TFunc, typename TAccumulate>
 	constexpr auto Aggregate(TFunc&& func, const TAccumulate& seed)
 	{
-		return Adaptors::AgregateAdaptor2<TFunc, TAccumulate>(std::forward<TFunc>(func), seed);
+		return Adaptors::AgregateAdaptor2<std::decay_t<TFunc>, TAccumulate>(std::forward<TFunc>(func), seed);
 	}	
 
+	template<typename TFunc, typename TCombine, typename TAccumulate>
+	constexpr auto AggregateParallel(TFunc&& func, TCombine&& combine, const TAccumulate& seed, ReduceOptions options = {})
+	{
+		return Adaptors::AggregateParallelAdaptor<std::decay_t<TFunc>, std::decay_t<TCombine>, TAccumulate>(
+			std::forward<TFunc>(func),
+			std::forward<TCombine>(combine),
+			seed,
+			options
+		);
+	}
+
 	template<typename TPredicate>
 	constexpr auto All(TPredicate&& predicate)
 	{
@@ -34,14 +50,47 @@ namespace Ranges
 		return Adaptors::AppendAdaptor<TValue>(value);
 	}
 
+	constexpr auto ArgMax()
+	{
+		return Adaptors::ArgMaxAdaptor();
+	}
+
+	template<typename TProjection>
+	constexpr auto ArgMaxBy(TProjection projection)
+	{
+		return Adaptors::ArgMaxAdaptor<TProjection>(std::move(projection));
+	}
+
+	constexpr auto ArgMin()
+	{
+		return Adaptors::ArgMinAdaptor();
+	}
+
+	template<typename TProjection>
+	constexpr auto ArgMinBy(TProjection projection)
+	{
+		return Adaptors::ArgMinAdaptor<TProjection>(std::move(projection));
+	}
+
 	constexpr auto AsView()
 	{
 		return std::views::all;
 	}
 
-	constexpr auto Average()
+	constexpr auto Average(Summation summation = Summation::Naive)
+	{
+		return Adaptors::AverageAdaptor(summation);
+	}
+
+	constexpr auto BottomK(size_t count)
 	{
-		return Adaptors::AverageAdaptor();
+		return Adaptors::TopAdaptor<std::less>(count);
+	}
+
+	template<typename TProjection>
+	constexpr auto BottomK(size_t count, TProjection projection)
+	{
+		return Adaptors::TopAdaptor<std::less, TProjection>(count, std::move(projection));
 	}
 
 	template<typename TResult>
@@ -145,6 +194,28 @@ namespace Ranges
 		return Adaptors::LastOrDefaultAdaptor2<TPredicate>(std::move(predicate));
 	}
 
+	constexpr auto LiveOrder(SortOptions options = {})
+	{
+		return Adaptors::LiveOrderAdaptor<std::less>(std::identity(), options);
+	}
+
+	template<typename TProjection>
+	constexpr auto LiveOrderBy(TProjection projection, SortOptions options = {})
+	{
+		return Adaptors::LiveOrderAdaptor<std::less, TProjection>(std::move(projection), options);
+	}
+
+	template<typename TProjection>
+	constexpr auto LiveOrderByDescending(TProjection projection, SortOptions options = {})
+	{
+		return Adaptors::LiveOrderAdaptor<std::greater, TProjection>(std::move(projection), options);
+	}
+
+	constexpr auto LiveOrderDescending(SortOptions options = {})
+	{
+		return Adaptors::LiveOrderAdaptor<std::greater>(std::identity(), options);
+	}
+
 	constexpr auto Max()
 	{
 		return Adaptors::MaxAdaptor();
@@ -167,26 +238,114 @@ namespace Ranges
 		return Adaptors::MinAdaptor<TProjection>(std::move(projection));
 	}	
 
-	constexpr auto Order()
+	constexpr auto MinMax()
+	{
+		return Adaptors::MinMaxAdaptor();
+	}
+
+	template<typename TProjection>
+	constexpr auto MinMaxBy(TProjection projection)
+	{
+		return Adaptors::MinMaxAdaptor<TProjection>(std::move(projection));
+	}
+
+	constexpr auto Order(SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::less>(std::identity(), options);
+	}
+
+	constexpr auto Order(ExternalSortOptions options)
+	{
+		return Adaptors::ExternalOrderAdaptor<std::less>(std::identity(), options);
+	}
+
+	template<Adaptors::AllocatorSource TAllocator>
+	constexpr auto Order(TAllocator allocator, SortOptions options = {})
+	{
+		using TAdaptor = Adaptors::OrderAdaptor<std::less, std::identity, false, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::identity(), options, Adaptors::MakeAllocator(allocator));
+	}
+
+	template<typename TProjection>
+	constexpr auto OrderBy(TProjection projection, SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::less, TProjection>(std::move(projection), options);
+	}
+
+	template<typename TProjection>
+	constexpr auto OrderBy(TProjection projection, ExternalSortOptions options)
+	{
+		return Adaptors::ExternalOrderAdaptor<std::less, TProjection>(std::move(projection), options);
+	}
+
+	template<typename TProjection, Adaptors::AllocatorSource TAllocator>
+	constexpr auto OrderBy(TProjection projection, TAllocator allocator, SortOptions options = {})
+	{
+		using TAdaptor = Adaptors::OrderAdaptor<std::less, TProjection, false, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::move(projection), options, Adaptors::MakeAllocator(allocator));
+	}
+
+	constexpr auto OrderDescending(SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::greater>(std::identity(), options);
+	}
+
+	constexpr auto OrderDescending(ExternalSortOptions options)
 	{
-		return Adaptors::OrderAdaptor<std::less>();
+		return Adaptors::ExternalOrderAdaptor<std::greater>(std::identity(), options);
+	}
+
+	template<Adaptors::AllocatorSource TAllocator>
+	constexpr auto OrderDescending(TAllocator allocator, SortOptions options = {})
+	{
+		using TAdaptor = Adaptors::OrderAdaptor<std::greater, std::identity, false, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::identity(), options, Adaptors::MakeAllocator(allocator));
+	}
+
+	template<typename TProjection>
+	constexpr auto OrderByDescending(TProjection projection, SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::greater, TProjection>(std::move(projection), options);
 	}
 
 	template<typename TProjection>
-	constexpr auto OrderBy(TProjection projection)
+	constexpr auto OrderByDescending(TProjection projection, ExternalSortOptions options)
 	{
-		return Adaptors::OrderAdaptor<std::less, TProjection>(std::move(projection));
+		return Adaptors::ExternalOrderAdaptor<std::greater, TProjection>(std::move(projection), options);
 	}
 
-	constexpr auto OrderDescending()
+	template<typename TProjection, Adaptors::AllocatorSource TAllocator>
+	constexpr auto OrderByDescending(TProjection projection, TAllocator allocator, SortOptions options = {})
 	{
-		return Adaptors::OrderAdaptor<std::greater>();
+		using TAdaptor = Adaptors::OrderAdaptor<std::greater, TProjection, false, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::move(projection), options, Adaptors::MakeAllocator(allocator));
 	}
 
 	template<typename TProjection>
-	constexpr auto OrderByDescending(TProjection projection)
+	constexpr auto OrderByDescendingIndirect(TProjection projection, SortOptions options = {})
 	{
-		return Adaptors::OrderAdaptor<std::greater, TProjection>(std::move(projection));
+		return Adaptors::OrderAdaptor<std::greater, TProjection, true>(std::move(projection), options);
+	}
+
+	template<typename TProjection>
+	constexpr auto OrderByIndirect(TProjection projection, SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::less, TProjection, true>(std::move(projection), options);
+	}
+
+	constexpr auto OrderDescendingIndirect(SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::greater, std::identity, true>(std::identity(), options);
+	}
+
+	constexpr auto OrderIndirect(SortOptions options = {})
+	{
+		return Adaptors::OrderAdaptor<std::less, std::identity, true>(std::identity(), options);
+	}
+
+	constexpr auto Parallel(size_t concurrency = 0)
+	{
+		return Adaptors::ParallelAdaptor(concurrency);
 	}
 
 	constexpr auto Range(int start, int count)
@@ -218,7 +377,7 @@ namespace Ranges
 
 	constexpr auto Slice(size_t start, size_t count)
 	{
-		return std::views::drop(start) | std::views::take(count);
+		return Adaptors::SliceAdaptor(start, count);
 	}
 
 	template <typename TDelimeter>
@@ -227,9 +386,20 @@ namespace Ranges
 		return std::views::split(std::forward<TDelimeter>(deliemter));
 	}
 
+	constexpr auto Sum(Summation summation = Summation::Naive)
+	{
+		return Adaptors::SumAdaptor(std::identity(), summation);
+	}
+
+	template<typename TProjection>
+	constexpr auto SumBy(TProjection projection, Summation summation = Summation::Naive)
+	{
+		return Adaptors::SumAdaptor<TProjection>(std::move(projection), summation);
+	}
+
 	constexpr auto Take(size_t lenght)
 	{
-		return std::views::take(lenght);
+		return Adaptors::TakeAdaptor(lenght);
 	}
 
 	template<typename TPredicate>
@@ -238,13 +408,39 @@ namespace Ranges
 		return std::views::take_while(std::forward<TPredicate>(predicate));
 	}
 
+	template<typename TProjection>
+	constexpr auto ThenBy(TProjection projection)
+	{
+		return Adaptors::ThenAdaptor<std::less, TProjection>(std::move(projection));
+	}
+
+	template<typename TProjection>
+	constexpr auto ThenByDescending(TProjection projection)
+	{
+		return Adaptors::ThenAdaptor<std::greater, TProjection>(std::move(projection));
+	}
+
 	template<template<typename...> typename TContainer>
 	constexpr auto To()
 	{
 		return Adaptors::ToAdaptor<TContainer>();
 	}
 
+	template<template<typename...> typename TContainer, Adaptors::AllocatorSource TAllocator>
+	constexpr auto To(TAllocator allocator)
+	{
+		return Adaptors::ToAdaptor<TContainer, decltype(Adaptors::MakeAllocator(allocator))>(Adaptors::MakeAllocator(allocator));
+	}
+
+	template<typename TKeySelector, typename TElementSelector, Adaptors::AllocatorSource TAllocator>
+	constexpr auto ToUnorderedMap(TKeySelector keySelector, TElementSelector elementSelector, TAllocator allocator)
+	{
+		using TAdaptor = Adaptors::ToUnorderedMapAdaptor<TKeySelector, TElementSelector, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::move(keySelector), std::move(elementSelector), Adaptors::MakeAllocator(allocator));
+	}
+
 	template<typename TKeySelector, typename TElementSelector>
+		requires (!Adaptors::AllocatorSource<std::remove_cvref_t<TElementSelector>>)
 	constexpr auto ToUnorderedMap(TKeySelector&& keySelector, TElementSelector&& elementSelector)
 	{
 		return Adaptors::ToUnorderedMapAdaptor<TKeySelector, TElementSelector>(
@@ -259,9 +455,16 @@ namespace Ranges
 		return Adaptors::ToUnorderedMapAdaptor2<TSelector>(std::forward<TSelector>(selector));
 	}
 
+	template<typename TSelector, Adaptors::AllocatorSource TAllocator>
+	constexpr auto ToUnorderedMap(TSelector selector, TAllocator allocator)
+	{
+		using TAdaptor = Adaptors::ToUnorderedMapAdaptor2<TSelector, decltype(Adaptors::MakeAllocator(allocator))>;
+		return TAdaptor(std::move(selector), Adaptors::MakeAllocator(allocator));
+	}
+
 	constexpr auto ToUnorderedMap()
 	{
-		return To<std::unordered_map>;
+		return To<std::unordered_map>();
 	}
 
 	constexpr auto ToVector()
@@ -269,6 +472,23 @@ namespace Ranges
 		return To<std::vector>();
 	}
 
+	template<Adaptors::AllocatorSource TAllocator>
+	constexpr auto ToVector(TAllocator allocator)
+	{
+		return To<std::vector>(allocator);
+	}
+
+	constexpr auto TopK(size_t count)
+	{
+		return Adaptors::TopAdaptor<std::greater>(count);
+	}
+
+	template<typename TProjection>
+	constexpr auto TopK(size_t count, TProjection projection)
+	{
+		return Adaptors::TopAdaptor<std::greater, TProjection>(count, std::move(projection));
+	}
+
 	constexpr auto Values()
 	{
 		return std::views::values;
@@ -0,0 +1,762 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <type_traits>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace Simd
+{
+	enum class Summation
+	{
+		Naive, Kahan, Pairwise, Reproducible
+	};
+
+	constexpr size_t Lanes = 8;
+	constexpr size_t PairwiseBlockSize = 128;
+	constexpr size_t ReproducibleBlockSize = 4096;
+
+	template<typename TRange>
+	concept ContiguousArithmeticRange =
+		std::ranges::contiguous_range<TRange> &&
+		std::ranges::sized_range<TRange> &&
+		std::is_arithmetic_v<std::ranges::range_value_t<TRange>>;
+
+	template<typename T>
+	struct SumTraits
+	{
+		using Type = T;
+	};
+
+	template<typename T> requires std::is_integral_v<T> && std::is_signed_v<T>
+	struct SumTraits<T>
+	{
+		using Type = int64_t;
+	};
+
+	template<typename T> requires std::is_integral_v<T> && std::is_unsigned_v<T>
+	struct SumTraits<T>
+	{
+		using Type = uint64_t;
+	};
+
+	template<>
+	struct SumTraits<float>
+	{
+		using Type = double;
+	};
+
+	template<typename T>
+	using SumResult = typename SumTraits<T>::Type;
+
+	template<typename TAccumulator>
+	constexpr TAccumulator ReduceLanes(const TAccumulator* lanes)
+	{
+		return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+	}
+
+#if defined(__AVX__)
+	inline __m256d Load4(const double* data)
+	{
+		return _mm256_loadu_pd(data);
+	}
+
+	inline __m256d Load4(const float* data)
+	{
+		return _mm256_cvtps_pd(_mm_loadu_ps(data));
+	}
+#elif defined(__SSE2__) || defined(_M_X64)
+	inline __m128d Load2(const double* data)
+	{
+		return _mm_loadu_pd(data);
+	}
+
+	inline __m128d Load2(const float* data)
+	{
+		return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data))));
+	}
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+	template<typename T>
+	int64_t SumBytes(const T* data, size_t size, size_t& i)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i bias = std::is_signed_v<T> ? _mm_set1_epi8(static_cast<char>(0x80)) : zero;
+		__m128i total = zero;
+
+		for(; i + 16 <= size; i += 16)
+		{
+			__m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+			total = _mm_add_epi64(total, _mm_sad_epu8(values, zero));
+		}
+
+		alignas(16) int64_t parts[2];
+		_mm_store_si128(reinterpret_cast<__m128i*>(parts), total);
+
+		int64_t sum = parts[0] + parts[1];
+		return std::is_signed_v<T> ? sum - 128 * static_cast<int64_t>(i) : sum;
+	}
+
+	template<typename T>
+	int64_t SumShorts(const T* data, size_t size, size_t& i)
+	{
+		constexpr size_t BlockSize = 8 * 16384;
+		const __m128i ones = _mm_set1_epi16(1);
+		const __m128i bias = std::is_signed_v<T> ? _mm_setzero_si128() : _mm_set1_epi16(static_cast<short>(0x8000));
+		int64_t sum = 0;
+
+		while(i + 8 <= size)
+		{
+			__m128i block = _mm_setzero_si128();
+			size_t blockEnd = std::min(size, i + BlockSize);
+
+			for(; i + 8 <= blockEnd; i += 8)
+			{
+				__m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+				block = _mm_add_epi32(block, _mm_madd_epi16(values, ones));
+			}
+
+			alignas(16) int32_t parts[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(parts), block);
+			sum += static_cast<int64_t>(parts[0]) + parts[1] + parts[2] + parts[3];
+		}
+
+		return std::is_signed_v<T> ? sum : sum + 32768 * static_cast<int64_t>(i);
+	}
+#endif
+
+	template<typename TAccumulator, typename T>
+	TAccumulator SumLanes(const T* data, size_t size)
+	{
+		TAccumulator lanes[Lanes] = {};
+		size_t i = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+		if constexpr(std::is_integral_v<TAccumulator> && sizeof(TAccumulator) == 8 && std::is_integral_v<T> && sizeof(T) == 1)
+		{
+			lanes[0] = static_cast<TAccumulator>(SumBytes(data, size, i));
+		}
+		else if constexpr(std::is_integral_v<TAccumulator> && sizeof(TAccumulator) == 8 && std::is_integral_v<T> && sizeof(T) == 2)
+		{
+			lanes[0] = static_cast<TAccumulator>(SumShorts(data, size, i));
+		}
+#endif
+
+#if defined(__AVX__)
+		if constexpr(std::is_same_v<TAccumulator, double> && (std::is_same_v<T, double> || std::is_same_v<T, float>))
+		{
+			__m256d low = _mm256_setzero_pd();
+			__m256d high = _mm256_setzero_pd();
+
+			for(; i + Lanes <= size; i += Lanes)
+			{
+				low = _mm256_add_pd(low, Load4(data + i));
+				high = _mm256_add_pd(high, Load4(data + i + 4));
+			}
+
+			_mm256_storeu_pd(lanes, low);
+			_mm256_storeu_pd(lanes + 4, high);
+		}
+#elif defined(__SSE2__) || defined(_M_X64)
+		if constexpr(std::is_same_v<TAccumulator, double> && (std::is_same_v<T, double> || std::is_same_v<T, float>))
+		{
+			__m128d sums[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+
+			for(; i + Lanes <= size; i += Lanes)
+			{
+				for(size_t k = 0; k < 4; k++)
+				{
+					sums[k] = _mm_add_pd(sums[k], Load2(data + i + 2 * k));
+				}
+			}
+
+			for(size_t k = 0; k < 4; k++)
+			{
+				_mm_storeu_pd(lanes + 2 * k, sums[k]);
+			}
+		}
+#endif
+
+		for(; i + Lanes <= size; i += Lanes)
+		{
+			for(size_t k = 0; k < Lanes; k++)
+			{
+				lanes[k] += static_cast<TAccumulator>(data[i + k]);
+			}
+		}
+
+		TAccumulator result = ReduceLanes(lanes);
+		for(; i < size; i++)
+		{
+			result += static_cast<TAccumulator>(data[i]);
+		}
+
+		return result;
+	}
+
+	template<typename TAccumulator>
+	constexpr void NeumaierAdd(TAccumulator& sum, TAccumulator& compensation, TAccumulator value)
+	{
+		TAccumulator total = sum + value;
+
+		if((sum < 0 ? -sum : sum) >= (value < 0 ? -value : value))
+		{
+			compensation += (sum - total) + value;
+		}
+		else
+		{
+			compensation += (value - total) + sum;
+		}
+
+		sum = total;
+	}
+
+	template<typename TAccumulator, typename T>
+	TAccumulator KahanSumLanes(const T* data, size_t size)
+	{
+		if constexpr(!std::is_floating_point_v<TAccumulator>)
+		{
+			return SumLanes<TAccumulator>(data, size);
+		}
+		else
+		{
+			TAccumulator sums[Lanes] = {};
+			TAccumulator compensations[Lanes] = {};
+			size_t i = 0;
+
+			for(; i + Lanes <= size; i += Lanes)
+			{
+				for(size_t k = 0; k < Lanes; k++)
+				{
+					TAccumulator value = static_cast<TAccumulator>(data[i + k]) - compensations[k];
+					TAccumulator total = sums[k] + value;
+					compensations[k] = (total - sums[k]) - value;
+					sums[k] = total;
+				}
+			}
+
+			TAccumulator sum = {};
+			TAccumulator compensation = {};
+
+			for(size_t k = 0; k < Lanes; k++)
+			{
+				NeumaierAdd(sum, compensation, sums[k]);
+				compensation -= compensations[k];
+			}
+
+			for(; i < size; i++)
+			{
+				NeumaierAdd(sum, compensation, static_cast<TAccumulator>(data[i]));
+			}
+
+			return sum + compensation;
+		}
+	}
+
+	template<typename TAccumulator, typename T>
+	TAccumulator PairwiseSum(const T* data, size_t size)
+	{
+		if(size <= PairwiseBlockSize)
+		{
+			return SumLanes<TAccumulator>(data, size);
+		}
+
+		size_t half = (size / 2 + PairwiseBlockSize - 1) / PairwiseBlockSize * PairwiseBlockSize;
+		return PairwiseSum<TAccumulator>(data, half) + PairwiseSum<TAccumulator>(data + half, size - half);
+	}
+
+	template<typename TAccumulator, typename T>
+	TAccumulator ReproducibleSum(const T* data, size_t size);
+
+	template<typename TAccumulator, typename T>
+	TAccumulator Sum(const T* data, size_t size, Summation summation = Summation::Naive)
+	{
+		switch(summation)
+		{
+			case Summation::Kahan:
+				return KahanSumLanes<TAccumulator>(data, size);
+
+			case Summation::Pairwise:
+				return PairwiseSum<TAccumulator>(data, size);
+
+			case Summation::Reproducible:
+				return ReproducibleSum<TAccumulator>(data, size);
+
+			default:
+				return SumLanes<TAccumulator>(data, size);
+		}
+	}
+
+	template<typename TElement, typename T>
+	concept Searchable =
+		std::is_arithmetic_v<TElement> && std::is_arithmetic_v<T> &&
+		!std::is_same_v<TElement, bool> && !std::is_same_v<T, bool> &&
+		std::is_floating_point_v<TElement> == std::is_floating_point_v<T>;
+
+#if defined(__AVX2__)
+	using Vector = __m256i;
+
+	inline Vector LoadVector(const void* data)
+	{
+		return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+	}
+
+	inline uint32_t MoveMask(Vector vector)
+	{
+		return static_cast<uint32_t>(_mm256_movemask_epi8(vector));
+	}
+
+	template<typename T>
+	Vector Broadcast(T value)
+	{
+		if constexpr(sizeof(T) == 2)
+		{
+			return _mm256_set1_epi16(std::bit_cast<int16_t>(value));
+		}
+		else if constexpr(sizeof(T) == 4)
+		{
+			return _mm256_set1_epi32(std::bit_cast<int32_t>(value));
+		}
+		else
+		{
+			return _mm256_set1_epi64x(std::bit_cast<int64_t>(value));
+		}
+	}
+
+	template<typename T>
+	Vector CompareEqual(Vector left, Vector right)
+	{
+		if constexpr(std::is_same_v<T, float>)
+		{
+			return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right), _CMP_EQ_OQ));
+		}
+		else if constexpr(std::is_same_v<T, double>)
+		{
+			return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right), _CMP_EQ_OQ));
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return _mm256_cmpeq_epi16(left, right);
+		}
+		else if constexpr(sizeof(T) == 4)
+		{
+			return _mm256_cmpeq_epi32(left, right);
+		}
+		else
+		{
+			return _mm256_cmpeq_epi64(left, right);
+		}
+	}
+#elif defined(__SSE2__) || defined(_M_X64)
+	using Vector = __m128i;
+
+	inline Vector LoadVector(const void* data)
+	{
+		return _mm_loadu_si128(static_cast<const __m128i*>(data));
+	}
+
+	inline uint32_t MoveMask(Vector vector)
+	{
+		return static_cast<uint32_t>(_mm_movemask_epi8(vector));
+	}
+
+	template<typename T>
+	Vector Broadcast(T value)
+	{
+		if constexpr(sizeof(T) == 2)
+		{
+			return _mm_set1_epi16(std::bit_cast<int16_t>(value));
+		}
+		else if constexpr(sizeof(T) == 4)
+		{
+			return _mm_set1_epi32(std::bit_cast<int32_t>(value));
+		}
+		else
+		{
+			return _mm_set1_epi64x(std::bit_cast<int64_t>(value));
+		}
+	}
+
+	template<typename T>
+	Vector CompareEqual(Vector left, Vector right)
+	{
+		if constexpr(std::is_same_v<T, float>)
+		{
+			return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+		}
+		else if constexpr(std::is_same_v<T, double>)
+		{
+			return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return _mm_cmpeq_epi16(left, right);
+		}
+		else if constexpr(sizeof(T) == 4)
+		{
+			return _mm_cmpeq_epi32(left, right);
+		}
+		else
+		{
+			Vector halves = _mm_cmpeq_epi32(left, right);
+			return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+		}
+	}
+#endif
+
+	template<typename T>
+	const T* Find(const T* first, const T* last, T value)
+	{
+		if constexpr(sizeof(T) == 1 && std::is_integral_v<T>)
+		{
+			const void* found = std::memchr(first, static_cast<unsigned char>(value), static_cast<size_t>(last - first));
+			return found ? static_cast<const T*>(found) : last;
+		}
+		else
+		{
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+			if constexpr(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+			{
+				constexpr size_t Width = sizeof(Vector) / sizeof(T);
+				const Vector needle = Broadcast(value);
+
+				for(; last - first >= static_cast<ptrdiff_t>(Width); first += Width)
+				{
+					if(uint32_t mask = MoveMask(CompareEqual<T>(LoadVector(first), needle)))
+					{
+						return first + std::countr_zero(mask) / sizeof(T);
+					}
+				}
+			}
+#endif
+
+			for(; first != last; ++first)
+			{
+				if(*first == value)
+				{
+					return first;
+				}
+			}
+
+			return last;
+		}
+	}
+
+#if defined(__AVX2__)
+	template<typename T>
+	constexpr bool HasVectorMinMax = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 4;
+
+	inline void StoreVector(void* data, Vector vector)
+	{
+		_mm256_storeu_si256(static_cast<__m256i*>(data), vector);
+	}
+
+	template<typename T>
+	Vector VectorMin(Vector left, Vector right)
+	{
+		if constexpr(sizeof(T) == 1)
+		{
+			return std::is_signed_v<T> ? _mm256_min_epi8(left, right) : _mm256_min_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return std::is_signed_v<T> ? _mm256_min_epi16(left, right) : _mm256_min_epu16(left, right);
+		}
+		else
+		{
+			return std::is_signed_v<T> ? _mm256_min_epi32(left, right) : _mm256_min_epu32(left, right);
+		}
+	}
+
+	template<typename T>
+	Vector VectorMax(Vector left, Vector right)
+	{
+		if constexpr(sizeof(T) == 1)
+		{
+			return std::is_signed_v<T> ? _mm256_max_epi8(left, right) : _mm256_max_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return std::is_signed_v<T> ? _mm256_max_epi16(left, right) : _mm256_max_epu16(left, right);
+		}
+		else
+		{
+			return std::is_signed_v<T> ? _mm256_max_epi32(left, right) : _mm256_max_epu32(left, right);
+		}
+	}
+#elif defined(__SSE2__) || defined(_M_X64)
+#if defined(__SSE4_1__)
+	template<typename T>
+	constexpr bool HasVectorMinMax = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 4;
+#else
+	template<typename T>
+	constexpr bool HasVectorMinMax =
+		std::is_same_v<T, uint8_t> || std::is_same_v<T, unsigned char> ||
+		std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t>;
+#endif
+
+	inline void StoreVector(void* data, Vector vector)
+	{
+		_mm_storeu_si128(static_cast<__m128i*>(data), vector);
+	}
+
+	template<typename T>
+	Vector VectorMin(Vector left, Vector right)
+	{
+#if defined(__SSE4_1__)
+		if constexpr(sizeof(T) == 1)
+		{
+			return std::is_signed_v<T> ? _mm_min_epi8(left, right) : _mm_min_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return std::is_signed_v<T> ? _mm_min_epi16(left, right) : _mm_min_epu16(left, right);
+		}
+		else
+		{
+			return std::is_signed_v<T> ? _mm_min_epi32(left, right) : _mm_min_epu32(left, right);
+		}
+#else
+		if constexpr(sizeof(T) == 1 && std::is_unsigned_v<T>)
+		{
+			return _mm_min_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2 && std::is_signed_v<T>)
+		{
+			return _mm_min_epi16(left, right);
+		}
+		else
+		{
+			Vector mask = _mm_cmpgt_epi32(right, left);
+			return _mm_or_si128(_mm_and_si128(mask, left), _mm_andnot_si128(mask, right));
+		}
+#endif
+	}
+
+	template<typename T>
+	Vector VectorMax(Vector left, Vector right)
+	{
+#if defined(__SSE4_1__)
+		if constexpr(sizeof(T) == 1)
+		{
+			return std::is_signed_v<T> ? _mm_max_epi8(left, right) : _mm_max_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2)
+		{
+			return std::is_signed_v<T> ? _mm_max_epi16(left, right) : _mm_max_epu16(left, right);
+		}
+		else
+		{
+			return std::is_signed_v<T> ? _mm_max_epi32(left, right) : _mm_max_epu32(left, right);
+		}
+#else
+		if constexpr(sizeof(T) == 1 && std::is_unsigned_v<T>)
+		{
+			return _mm_max_epu8(left, right);
+		}
+		else if constexpr(sizeof(T) == 2 && std::is_signed_v<T>)
+		{
+			return _mm_max_epi16(left, right);
+		}
+		else
+		{
+			Vector mask = _mm_cmpgt_epi32(left, right);
+			return _mm_or_si128(_mm_and_si128(mask, left), _mm_andnot_si128(mask, right));
+		}
+#endif
+	}
+#endif
+
+	template<typename T> requires std::is_arithmetic_v<T>
+	std::ranges::minmax_result<T> MinMax(const T* data, size_t size)
+	{
+		T min = data[0];
+		T max = data[0];
+		size_t i = 1;
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+		if constexpr(HasVectorMinMax<T>)
+		{
+			constexpr size_t Width = sizeof(Vector) / sizeof(T);
+
+			if(size >= Width)
+			{
+				Vector mins = LoadVector(data);
+				Vector maxs = mins;
+
+				for(i = Width; i + Width <= size; i += Width)
+				{
+					Vector values = LoadVector(data + i);
+					mins = VectorMin<T>(mins, values);
+					maxs = VectorMax<T>(maxs, values);
+				}
+
+				T lanes[Width];
+				StoreVector(lanes, mins);
+				min = *std::min_element(lanes, lanes + Width);
+				StoreVector(lanes, maxs);
+				max = *std::max_element(lanes, lanes + Width);
+			}
+		}
+#endif
+
+		for(; i < size; i++)
+		{
+			min = data[i] < min ? data[i] : min;
+			max = data[i] < max ? max : data[i];
+		}
+
+		return { min, max };
+	}
+
+	template<typename TElement, typename T> requires Searchable<TElement, T>
+	bool Contains(const TElement* data, size_t size, const T& value)
+	{
+		using TCommon = decltype(TElement() + T());
+
+		TElement needle = static_cast<TElement>(static_cast<TCommon>(value));
+		if(static_cast<TCommon>(needle) != static_cast<TCommon>(value))
+		{
+			return false;
+		}
+
+		return Find(data, data + size, needle) != data + size;
+	}
+
+	template<typename TAccumulator>
+	class Summator
+	{
+	private:
+		Summation _summation;
+		TAccumulator _sum = {};
+		TAccumulator _compensation = {};
+		size_t _blockSize = 0;
+		size_t _blocks = 0;
+		size_t _depth = 0;
+		std::array<TAccumulator, 64> _levels = {};
+		std::array<TAccumulator, Lanes> _lanes = {};
+		std::array<TAccumulator, Lanes> _pending = {};
+	public:
+		constexpr explicit Summator(Summation summation = Summation::Naive):
+			_summation(summation)
+		{}
+
+		constexpr void Add(const TAccumulator& value)
+		{
+			if constexpr(std::is_floating_point_v<TAccumulator>)
+			{
+				if(_summation == Summation::Kahan)
+				{
+					NeumaierAdd(_sum, _compensation, value);
+					return;
+				}
+
+				if(_summation == Summation::Pairwise)
+				{
+					_sum += value;
+
+					if(++_blockSize == PairwiseBlockSize)
+					{
+						AddBlock(_sum);
+					}
+
+					return;
+				}
+
+				if(_summation == Summation::Reproducible)
+				{
+					_pending[_blockSize++ % Lanes] = value;
+
+					if(_blockSize % Lanes == 0)
+					{
+						for(size_t k = 0; k < Lanes; k++)
+						{
+							_lanes[k] += _pending[k];
+						}
+					}
+
+					if(_blockSize == ReproducibleBlockSize)
+					{
+						AddBlock(ReduceLanes(_lanes.data()));
+					}
+
+					return;
+				}
+			}
+
+			_sum += value;
+		}
+
+		constexpr void AddBlock(const TAccumulator& value)
+		{
+			TAccumulator carry = value;
+
+			for(size_t n = ++_blocks; n % 2 == 0; n /= 2)
+			{
+				carry = _levels[--_depth] + carry;
+			}
+
+			_levels[_depth++] = carry;
+			_sum = {};
+			_lanes = {};
+			_blockSize = 0;
+		}
+
+		constexpr TAccumulator Result() const
+		{
+			size_t depth = _depth;
+			TAccumulator result = depth != 0 && _blockSize == 0 ? _levels[--depth] : BlockResult();
+
+			for(size_t i = depth; i > 0; i--)
+			{
+				result = _levels[i - 1] + result;
+			}
+
+			return result;
+		}
+	private:
+		constexpr TAccumulator BlockResult() const
+		{
+			if(!std::is_floating_point_v<TAccumulator> || _summation != Summation::Reproducible)
+			{
+				return _sum + _compensation;
+			}
+
+			TAccumulator result = ReduceLanes(_lanes.data());
+			for(size_t k = 0; k < _blockSize % Lanes; k++)
+			{
+				result += _pending[k];
+			}
+
+			return result;
+		}
+	};
+
+	template<typename TAccumulator, typename T>
+	TAccumulator ReproducibleSum(const T* data, size_t size)
+	{
+		if constexpr(!std::is_floating_point_v<TAccumulator>)
+		{
+			return SumLanes<TAccumulator>(data, size);
+		}
+		else
+		{
+			Summator<TAccumulator> summator(Summation::Reproducible);
+			for(size_t i = 0; i < size; i += ReproducibleBlockSize)
+			{
+				summator.AddBlock(SumLanes<TAccumulator>(data + i, std::min(ReproducibleBlockSize, size - i)));
+			}
+
+			return summator.Result();
+		}
+	}
+}
@@ -0,0 +1,1173 @@
+#pragma once
+
+#include "Execution.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Sorting
+{
+	struct SortOptions
+	{
+		bool Parallel = false;
+		size_t ParallelThreshold = 1 << 16;
+		size_t Concurrency = 0;
+		bool Stable = true;
+	};
+
+	struct ExternalSortOptions
+	{
+		size_t MemoryBudget = size_t(256) << 20;
+	};
+
+	template<typename TAllocator, typename T>
+	using ReboundAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+	template<typename T>
+	constexpr const T& Unwrap(const T& key)
+	{
+		return key;
+	}
+
+	template<typename T>
+	constexpr T& Unwrap(std::reference_wrapper<T> key)
+	{
+		return key.get();
+	}
+
+	template<typename TComparer, typename TOtherComparer>
+	struct LexicographicComparer
+	{
+		TComparer First;
+		TOtherComparer Second;
+
+		template<typename TLeft, typename TRight>
+		constexpr bool operator()(const TLeft& left, const TRight& right) const
+		{
+			const auto& leftKey = Unwrap(std::get<0>(left));
+			const auto& rightKey = Unwrap(std::get<0>(right));
+
+			if(std::invoke(First, leftKey, rightKey))
+			{
+				return true;
+			}
+
+			if(std::invoke(First, rightKey, leftKey))
+			{
+				return false;
+			}
+
+			return std::invoke(Second, Unwrap(std::get<1>(left)), Unwrap(std::get<1>(right)));
+		}
+	};
+
+	template<typename TKey>
+	using StoredKey = std::conditional_t<std::is_lvalue_reference_v<TKey>, std::reference_wrapper<std::remove_reference_t<TKey>>, std::remove_cvref_t<TKey>>;
+
+	template<typename TProjection, typename TOtherProjection>
+	struct CompositeProjection
+	{
+		TProjection First;
+		TOtherProjection Second;
+
+		template<typename T>
+		constexpr auto operator()(T& item) const
+		{
+			return std::tuple<StoredKey<std::invoke_result_t<const TProjection&, T&>>, StoredKey<std::invoke_result_t<const TOtherProjection&, T&>>>(
+				std::invoke(First, item),
+				std::invoke(Second, item));
+		}
+	};
+
+	template<typename TProjection>
+	constexpr bool IsCompositeProjection = false;
+
+	template<typename TProjection, typename TOtherProjection>
+	constexpr bool IsCompositeProjection<CompositeProjection<TProjection, TOtherProjection>> = true;
+
+	template<std::ranges::input_range TRange, typename TComparer, typename TProjection>
+	auto SelectTop(TRange&& range, size_t count, const TComparer& comparer, const TProjection& projection)
+	{
+		using T = std::ranges::range_value_t<TRange>;
+
+		struct Entry
+		{
+			T Item;
+			size_t Sequence;
+		};
+
+		auto compare = [&](const Entry& left, const Entry& right)
+		{
+			decltype(auto) leftKey = std::invoke(projection, left.Item);
+			decltype(auto) rightKey = std::invoke(projection, right.Item);
+
+			if(std::invoke(comparer, leftKey, rightKey))
+			{
+				return true;
+			}
+
+			return !std::invoke(comparer, rightKey, leftKey) && left.Sequence < right.Sequence;
+		};
+
+		std::vector<T> top;
+		if(count == 0)
+		{
+			return top;
+		}
+
+		std::vector<Entry> heap;
+		if constexpr(std::ranges::sized_range<TRange>)
+		{
+			heap.reserve(std::min(count, static_cast<size_t>(std::ranges::size(range))));
+		}
+
+		size_t sequence = 0;
+		for(auto&& item : range)
+		{
+			if(heap.size() < count)
+			{
+				heap.push_back({ std::forward<decltype(item)>(item), sequence++ });
+				std::push_heap(heap.begin(), heap.end(), compare);
+			}
+			else if(std::invoke(comparer, std::invoke(projection, item), std::invoke(projection, heap.front().Item)))
+			{
+				std::pop_heap(heap.begin(), heap.end(), compare);
+				heap.back() = { std::forward<decltype(item)>(item), sequence++ };
+				std::push_heap(heap.begin(), heap.end(), compare);
+			}
+			else
+			{
+				sequence++;
+			}
+		}
+
+		std::sort_heap(heap.begin(), heap.end(), compare);
+
+		top.reserve(heap.size());
+		for(Entry& entry : heap)
+		{
+			top.push_back(std::move(entry.Item));
+		}
+
+		return top;
+	}
+
+	template<std::ranges::random_access_range TRange, typename TComparer, typename TProjection>
+	size_t NthIndex(TRange&& range, size_t position, const TComparer& comparer, const TProjection& projection)
+	{
+		auto first = std::ranges::begin(range);
+		std::vector<size_t> indices(static_cast<size_t>(std::ranges::distance(range)));
+		std::iota(indices.begin(), indices.end(), size_t(0));
+
+		std::ranges::nth_element(indices, indices.begin() + position, [&](size_t left, size_t right)
+		{
+			decltype(auto) leftKey = std::invoke(projection, first[left]);
+			decltype(auto) rightKey = std::invoke(projection, first[right]);
+
+			if(std::invoke(comparer, leftKey, rightKey))
+			{
+				return true;
+			}
+
+			return !std::invoke(comparer, rightKey, leftKey) && left < right;
+		});
+
+		return indices[position];
+	}
+
+	template<std::random_access_iterator TIterator, typename TComparer, typename TProjection>
+	void ParallelSort(TIterator first, TIterator last, const TComparer& comparer, const TProjection& projection, size_t concurrency)
+	{
+		size_t size = static_cast<size_t>(last - first);
+		size_t count = Execution::ChunkCount(size, concurrency == 0 ? Execution::ThreadPool::Default().Size() : concurrency);
+
+		std::vector<size_t> bounds;
+		for(size_t i = 0; i <= count; i++)
+		{
+			bounds.push_back(size * i / count);
+		}
+
+		Execution::ParallelFor(count, [&](size_t i)
+		{
+			std::ranges::stable_sort(first + bounds[i], first + bounds[i + 1], comparer, projection);
+		});
+
+		while(bounds.size() > 2)
+		{
+			Execution::ParallelFor((bounds.size() - 1) / 2, [&](size_t i)
+			{
+				std::ranges::inplace_merge(first + bounds[2 * i], first + bounds[2 * i + 1], first + bounds[2 * i + 2], comparer, projection);
+			});
+
+			std::vector<size_t> merged;
+			for(size_t i = 0; i < bounds.size(); i += 2)
+			{
+				merged.push_back(bounds[i]);
+			}
+
+			if(merged.back() != size)
+			{
+				merged.push_back(size);
+			}
+
+			bounds = std::move(merged);
+		}
+	}
+
+	constexpr size_t SmallSortSize = 32;
+	constexpr size_t NetworkSize = 16;
+
+	template<size_t Size, typename TFunc>
+	constexpr void ForEachComparator(TFunc&& func)
+	{
+		for(size_t p = 1; p < Size; p *= 2)
+		{
+			for(size_t k = p; k > 0; k /= 2)
+			{
+				for(size_t j = k % p; j + k < Size; j += 2 * k)
+				{
+					for(size_t i = 0; i < k && i + j + k < Size; i++)
+					{
+						if((i + j) / (2 * p) == (i + j + k) / (2 * p))
+						{
+							func(i + j, i + j + k);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	template<size_t Size>
+	constexpr auto MakeSortingNetwork()
+	{
+		constexpr size_t Length = []
+		{
+			size_t length = 0;
+			ForEachComparator<Size>([&](size_t, size_t) { length++; });
+			return length;
+		}();
+
+		std::array<std::pair<uint8_t, uint8_t>, Length> network = {};
+		size_t index = 0;
+
+		ForEachComparator<Size>([&](size_t first, size_t second)
+		{
+			network[index++] = { static_cast<uint8_t>(first), static_cast<uint8_t>(second) };
+		});
+
+		return network;
+	}
+
+	template<size_t Size>
+	constexpr auto SortingNetwork = MakeSortingNetwork<Size>();
+
+	template<size_t Size, bool Descending, typename T>
+	void NetworkSort(T* data, size_t size)
+	{
+		constexpr T Sentinel = Descending
+			? (std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest())
+			: (std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max());
+
+		std::array<T, Size> items;
+		items.fill(Sentinel);
+		std::copy_n(data, size, items.begin());
+
+		auto compareExchange = [&items](size_t first, size_t second)
+		{
+			T left = items[first];
+			T right = items[second];
+			bool swap = Descending ? left < right : right < left;
+			items[first] = swap ? right : left;
+			items[second] = swap ? left : right;
+		};
+
+		[&]<size_t... Indices>(std::index_sequence<Indices...>)
+		{
+			(compareExchange(SortingNetwork<Size>[Indices].first, SortingNetwork<Size>[Indices].second), ...);
+		}(std::make_index_sequence<SortingNetwork<Size>.size()>());
+
+		std::copy_n(items.begin(), size, data);
+	}
+
+	template<std::random_access_iterator TIterator, typename TComparer, typename TProjection>
+	void InsertionSort(TIterator first, TIterator last, const TComparer& comparer, const TProjection& projection)
+	{
+		for(auto it = first; it != last; ++it)
+		{
+			auto item = std::move(*it);
+			auto hole = it;
+
+			for(; hole != first && std::invoke(comparer, std::invoke(projection, item), std::invoke(projection, *(hole - 1))); --hole)
+			{
+				*hole = std::move(*(hole - 1));
+			}
+
+			*hole = std::move(item);
+		}
+	}
+
+	constexpr size_t MaxMergedRuns = 16;
+
+	template<std::random_access_iterator TIterator, typename TComparer, typename TProjection>
+	bool MergeRuns(TIterator first, TIterator last, const TComparer& comparer, const TProjection& projection)
+	{
+		auto less = [&](const auto& left, const auto& right)
+		{
+			return std::invoke(comparer, std::invoke(projection, left), std::invoke(projection, right));
+		};
+
+		size_t size = static_cast<size_t>(last - first);
+		std::array<size_t, MaxMergedRuns + 1> bounds = {};
+		size_t count = 0;
+
+		for(size_t start = 0; start < size; start = bounds[count])
+		{
+			if(count == MaxMergedRuns)
+			{
+				return false;
+			}
+
+			size_t end = start + 1;
+			if(end < size && less(first[end], first[start]))
+			{
+				while(end < size && !less(first[end - 1], first[end]))
+				{
+					end++;
+				}
+
+				std::reverse(first + start, first + end);
+
+				for(size_t from = start; from < end;)
+				{
+					size_t to = from + 1;
+					while(to < end && !less(first[to - 1], first[to]))
+					{
+						to++;
+					}
+
+					std::reverse(first + from, first + to);
+					from = to;
+				}
+			}
+			else
+			{
+				while(end < size && !less(first[end], first[end - 1]))
+				{
+					end++;
+				}
+			}
+
+			bounds[++count] = end;
+		}
+
+		for(size_t width = 1; width < count; width *= 2)
+		{
+			for(size_t i = 0; i + width < count; i += 2 * width)
+			{
+				size_t to = std::min(i + 2 * width, count);
+				std::inplace_merge(first + bounds[i], first + bounds[i + width], first + bounds[to], less);
+			}
+		}
+
+		return true;
+	}
+
+	constexpr size_t RadixThreshold = 256;
+
+	template<size_t Size>
+	using UnsignedOf =
+		std::conditional_t<Size == 1, uint8_t,
+		std::conditional_t<Size == 2, uint16_t,
+		std::conditional_t<Size == 4, uint32_t, uint64_t>>>;
+
+	template<typename TKey>
+	constexpr bool IsRadixKey =
+		(std::is_arithmetic_v<TKey> || std::is_enum_v<TKey>) &&
+		!std::is_same_v<TKey, long double> &&
+		(sizeof(TKey) == 1 || sizeof(TKey) == 2 || sizeof(TKey) == 4 || sizeof(TKey) == 8);
+
+	template<typename TComparer, typename TKey>
+	constexpr bool IsAscending =
+		std::is_same_v<TComparer, std::less<TKey>> ||
+		std::is_same_v<TComparer, std::less<>> ||
+		std::is_same_v<TComparer, std::ranges::less>;
+
+	template<typename TComparer, typename TKey>
+	constexpr bool IsDescending =
+		std::is_same_v<TComparer, std::greater<TKey>> ||
+		std::is_same_v<TComparer, std::greater<>> ||
+		std::is_same_v<TComparer, std::ranges::greater>;
+
+	template<typename T, typename TComparer, typename TProjection>
+	using SortKey = std::remove_cvref_t<std::invoke_result_t<const TProjection&, T&>>;
+
+	template<typename T, typename TComparer, typename TProjection>
+	concept RadixSortable =
+		IsRadixKey<SortKey<T, TComparer, TProjection>> &&
+		(IsAscending<TComparer, SortKey<T, TComparer, TProjection>> || IsDescending<TComparer, SortKey<T, TComparer, TProjection>>);
+
+	template<typename TKey>
+	constexpr auto RadixKey(TKey key)
+	{
+		using TUnsigned = UnsignedOf<sizeof(TKey)>;
+		constexpr TUnsigned SignBit = TUnsigned(1) << (sizeof(TKey) * 8 - 1);
+
+		if constexpr(std::is_enum_v<TKey>)
+		{
+			return RadixKey(static_cast<std::underlying_type_t<TKey>>(key));
+		}
+		else if constexpr(std::is_floating_point_v<TKey>)
+		{
+			TUnsigned bits = std::bit_cast<TUnsigned>(key == TKey(0) ? TKey(0) : key);
+			return static_cast<TUnsigned>(bits & SignBit ? ~bits : bits | SignBit);
+		}
+		else if constexpr(std::is_signed_v<TKey>)
+		{
+			return static_cast<TUnsigned>(static_cast<TUnsigned>(key) ^ SignBit);
+		}
+		else
+		{
+			return static_cast<TUnsigned>(key);
+		}
+	}
+
+	template<typename TItems, typename TGetKey>
+	void RadixPasses(TItems& items, TItems& buffer, const TGetKey& getKey)
+	{
+		using TKey = std::invoke_result_t<const TGetKey&, std::ranges::range_reference_t<TItems>>;
+
+		size_t size = items.size();
+		TKey min = std::numeric_limits<TKey>::max();
+		TKey max = 0;
+		std::array<std::array<size_t, 256>, sizeof(TKey)> counts = {};
+
+		for(const auto& item : items)
+		{
+			TKey key = getKey(item);
+			min = std::min(min, key);
+			max = std::max(max, key);
+
+			for(size_t digit = 0; digit < sizeof(TKey); digit++)
+			{
+				counts[digit][(key >> (digit * 8)) & 0xFF]++;
+			}
+		}
+
+		if(static_cast<size_t>(max - min) < size)
+		{
+			std::vector<size_t> offsets(static_cast<size_t>(max - min) + 2);
+			for(const auto& item : items)
+			{
+				offsets[getKey(item) - min + 1]++;
+			}
+
+			for(size_t i = 1; i < offsets.size(); i++)
+			{
+				offsets[i] += offsets[i - 1];
+			}
+
+			for(auto& item : items)
+			{
+				buffer[offsets[getKey(item) - min]++] = std::move(item);
+			}
+
+			items.swap(buffer);
+			return;
+		}
+
+		for(size_t digit = 0; digit < sizeof(TKey); digit++)
+		{
+			auto& count = counts[digit];
+			if(std::ranges::find(count, size) != count.end())
+			{
+				continue;
+			}
+
+			size_t offset = 0;
+			for(size_t& bucket : count)
+			{
+				offset += std::exchange(bucket, offset);
+			}
+
+			for(auto& item : items)
+			{
+				buffer[count[(getKey(item) >> (digit * 8)) & 0xFF]++] = std::move(item);
+			}
+
+			items.swap(buffer);
+		}
+	}
+
+	template<typename TIndex, typename T, typename TAllocator, typename TProjection>
+	void RadixSort(std::vector<T, TAllocator>& data, const TProjection& projection, bool descending)
+	{
+		using TKey = decltype(RadixKey(std::invoke(projection, data[0])));
+
+		if constexpr(std::is_same_v<TProjection, std::identity> && std::is_arithmetic_v<T>)
+		{
+			std::vector<T, TAllocator> buffer(data.size(), data.get_allocator());
+
+			RadixPasses(data, buffer, [descending](T value)
+			{
+				TKey key = RadixKey(value);
+				return descending ? static_cast<TKey>(~key) : key;
+			});
+		}
+		else
+		{
+			struct Entry
+			{
+				TKey Key;
+				TIndex Index;
+			};
+
+			std::vector<Entry, ReboundAllocator<TAllocator, Entry>> entries(data.size(), data.get_allocator());
+			std::vector<Entry, ReboundAllocator<TAllocator, Entry>> buffer(data.size(), data.get_allocator());
+
+			for(size_t i = 0; i < data.size(); i++)
+			{
+				TKey key = RadixKey(std::invoke(projection, data[i]));
+				entries[i] = { descending ? static_cast<TKey>(~key) : key, static_cast<TIndex>(i) };
+			}
+
+			RadixPasses(entries, buffer, [](const Entry& entry)
+			{
+				return entry.Key;
+			});
+
+			std::vector<T, TAllocator> sorted(data.get_allocator());
+			sorted.reserve(data.size());
+
+			for(const Entry& entry : entries)
+			{
+				sorted.push_back(std::move(data[entry.Index]));
+			}
+
+			data = std::move(sorted);
+		}
+	}
+
+	template<typename TKey>
+	constexpr bool HasReferenceMembers = false;
+
+	template<typename... TKeys>
+	constexpr bool HasReferenceMembers<std::tuple<TKeys...>> = (std::is_reference_v<TKeys> || ...);
+
+	template<typename TKey, typename TOtherKey>
+	constexpr bool HasReferenceMembers<std::pair<TKey, TOtherKey>> = std::is_reference_v<TKey> || std::is_reference_v<TOtherKey>;
+
+	template<typename TKey>
+	struct UnwrappedKey
+	{
+		using Type = TKey;
+	};
+
+	template<typename TKey>
+	struct UnwrappedKey<std::reference_wrapper<TKey>>
+	{
+		using Type = std::remove_cv_t<TKey>;
+	};
+
+	template<typename TComparer, typename TKey, typename TUnwrapped = typename UnwrappedKey<std::remove_cvref_t<TKey>>::Type>
+	constexpr bool IsPrefixKey =
+		(IsRadixKey<TUnwrapped> || std::is_same_v<TUnwrapped, std::string> || std::is_same_v<TUnwrapped, std::string_view>) &&
+		(IsAscending<TComparer, TUnwrapped> || IsDescending<TComparer, TUnwrapped>);
+
+	template<typename TComparer, typename TOtherComparer, typename TKey, typename TOtherKey, typename TUnwrapped>
+	constexpr bool IsPrefixKey<LexicographicComparer<TComparer, TOtherComparer>, std::tuple<TKey, TOtherKey>, TUnwrapped> =
+		IsPrefixKey<TComparer, TKey> && IsPrefixKey<TOtherComparer, TOtherKey>;
+
+	template<typename T, typename TComparer, typename TProjection>
+	concept PrefixSortable = IsPrefixKey<TComparer, SortKey<T, TComparer, TProjection>>;
+
+	class KeyPrefix
+	{
+	private:
+		uint64_t _value = 0;
+		size_t _remaining = sizeof(uint64_t);
+	public:
+		constexpr uint64_t Value() const
+		{
+			return _value;
+		}
+
+		constexpr bool IsFull() const
+		{
+			return _remaining == 0;
+		}
+
+		constexpr void Put(uint8_t byte)
+		{
+			if(_remaining != 0)
+			{
+				_remaining--;
+				_value |= uint64_t(byte) << (_remaining * 8);
+			}
+		}
+
+		template<typename TComparer, typename TKey>
+		constexpr void Append(const TComparer& comparer, const TKey& key)
+		{
+			using TUnwrapped = std::remove_cvref_t<decltype(Unwrap(key))>;
+
+			if constexpr(requires { comparer.First; comparer.Second; })
+			{
+				Append(comparer.First, std::get<0>(key));
+				Append(comparer.Second, std::get<1>(key));
+			}
+			else if constexpr(IsRadixKey<TUnwrapped>)
+			{
+				uint8_t mask = IsDescending<TComparer, TUnwrapped> ? 0xFF : 0x00;
+				auto bits = RadixKey(Unwrap(key));
+
+				for(size_t i = sizeof(bits); i-- > 0 && !IsFull();)
+				{
+					Put(static_cast<uint8_t>(bits >> (i * 8)) ^ mask);
+				}
+			}
+			else
+			{
+				uint8_t mask = IsDescending<TComparer, TUnwrapped> ? 0xFF : 0x00;
+
+				for(char symbol : std::string_view(Unwrap(key)))
+				{
+					if(IsFull())
+					{
+						return;
+					}
+
+					Put(static_cast<uint8_t>(symbol) ^ mask);
+					if(symbol == '\0')
+					{
+						Put(0xFF ^ mask);
+					}
+				}
+
+				Put(mask);
+				Put(mask);
+			}
+		}
+	};
+
+	template<typename T, typename TComparer, typename TProjection>
+	concept NetworkSortable =
+		std::is_integral_v<T> &&
+		std::is_same_v<TProjection, std::identity> &&
+		(IsAscending<TComparer, T> || IsDescending<TComparer, T>);
+
+	template<typename T, typename TComparer, typename TProjection>
+	void SortSmall(T* data, size_t size, const TComparer& comparer, const TProjection& projection)
+	{
+		if constexpr(NetworkSortable<T, TComparer, TProjection>)
+		{
+			constexpr bool Descending = IsDescending<TComparer, T>;
+
+			if(size <= NetworkSize / 2)
+			{
+				NetworkSort<NetworkSize / 2, Descending>(data, size);
+				return;
+			}
+
+			if(size <= NetworkSize)
+			{
+				NetworkSort<NetworkSize, Descending>(data, size);
+				return;
+			}
+		}
+
+		InsertionSort(data, data + size, comparer, projection);
+	}
+
+	template<typename T, typename TProjection>
+	constexpr bool ComputesKeys =
+		!std::is_same_v<TProjection, std::identity> &&
+		!std::is_member_object_pointer_v<TProjection> &&
+		!std::is_lvalue_reference_v<std::invoke_result_t<const TProjection&, T&>> &&
+		!HasReferenceMembers<std::remove_cvref_t<std::invoke_result_t<const TProjection&, T&>>> &&
+		std::movable<std::remove_cvref_t<std::invoke_result_t<const TProjection&, T&>>>;
+
+	template<typename T, typename TProjection, typename TOtherProjection>
+	constexpr bool ComputesKeys<T, CompositeProjection<TProjection, TOtherProjection>> =
+		ComputesKeys<T, TProjection> || ComputesKeys<T, TOtherProjection>;
+
+	template<typename T, typename TProjection>
+	concept CachesKeys = ComputesKeys<T, TProjection>;
+
+	template<typename T, typename TAllocator, typename TComparer, typename TProjection>
+	void Sort(std::vector<T, TAllocator>& data, const TComparer& comparer, const TProjection& projection, const SortOptions& options);
+
+	template<typename TIndex, typename T, typename TAllocator, typename TComparer, typename TProjection>
+	void PrefixSort(std::vector<T, TAllocator>& data, const TComparer& comparer, const TProjection& projection, const SortOptions& options)
+	{
+		struct Entry
+		{
+			uint64_t Prefix;
+			TIndex Index;
+		};
+
+		std::vector<Entry, ReboundAllocator<TAllocator, Entry>> entries(data.size(), data.get_allocator());
+
+		for(size_t i = 0; i < data.size(); i++)
+		{
+			KeyPrefix prefix;
+			prefix.Append(comparer, std::invoke(projection, data[i]));
+			entries[i] = { prefix.Value(), static_cast<TIndex>(i) };
+		}
+
+		auto compareTies = [&](const Entry& left, const Entry& right)
+		{
+			return std::invoke(comparer, std::invoke(projection, data[left.Index]), std::invoke(projection, data[right.Index]));
+		};
+
+		if(options.Parallel && data.size() >= options.ParallelThreshold)
+		{
+			ParallelSort(entries.begin(), entries.end(), [&](const Entry& left, const Entry& right)
+			{
+				return left.Prefix != right.Prefix ? left.Prefix < right.Prefix : compareTies(left, right);
+			}, std::identity(), options.Concurrency);
+		}
+		else
+		{
+			std::vector<Entry, ReboundAllocator<TAllocator, Entry>> buffer(data.size(), data.get_allocator());
+
+			RadixPasses(entries, buffer, [](const Entry& entry)
+			{
+				return entry.Prefix;
+			});
+
+			for(auto first = entries.begin(); first != entries.end();)
+			{
+				auto last = std::find_if(first + 1, entries.end(), [first](const Entry& entry)
+				{
+					return entry.Prefix != first->Prefix;
+				});
+
+				if(last - first > 1)
+				{
+					std::stable_sort(first, last, compareTies);
+				}
+
+				first = last;
+			}
+		}
+
+		std::vector<T, TAllocator> sorted(data.get_allocator());
+		sorted.reserve(data.size());
+
+		for(const Entry& entry : entries)
+		{
+			sorted.push_back(std::move(data[entry.Index]));
+		}
+
+		data = std::move(sorted);
+	}
+
+	template<typename TIndex, typename T, typename TAllocator, typename TComparer, typename TProjection>
+	void CachedKeySort(std::vector<T, TAllocator>& data, const TComparer& comparer, const TProjection& projection, const SortOptions& options)
+	{
+		struct Entry
+		{
+			SortKey<T, TComparer, TProjection> Key;
+			TIndex Index;
+		};
+
+		std::vector<Entry, ReboundAllocator<TAllocator, Entry>> entries(data.get_allocator());
+		entries.reserve(data.size());
+
+		for(size_t i = 0; i < data.size(); i++)
+		{
+			entries.push_back({ std::invoke(projection, data[i]), static_cast<TIndex>(i) });
+		}
+
+		Sort(entries, comparer, &Entry::Key, options);
+
+		std::vector<T, TAllocator> sorted(data.get_allocator());
+		sorted.reserve(data.size());
+
+		for(const Entry& entry : entries)
+		{
+			sorted.push_back(std::move(data[entry.Index]));
+		}
+
+		data = std::move(sorted);
+	}
+
+	template<typename T, typename TAllocator, typename TComparer, typename TProjection>
+	void Sort(std::vector<T, TAllocator>& data, const TComparer& comparer, const TProjection& projection, const SortOptions& options)
+	{
+		if constexpr(!CachesKeys<T, TProjection>)
+		{
+			if(data.size() <= SmallSortSize)
+			{
+				SortSmall(data.data(), data.size(), comparer, projection);
+				return;
+			}
+
+			if(MergeRuns(data.begin(), data.end(), comparer, projection))
+			{
+				return;
+			}
+		}
+
+		if constexpr(CachesKeys<T, TProjection>)
+		{
+			if constexpr(RadixSortable<T, TComparer, TProjection>)
+			{
+				constexpr bool Descending = IsDescending<TComparer, SortKey<T, TComparer, TProjection>>;
+
+				if(data.size() >= RadixThreshold && !(options.Parallel && data.size() >= options.ParallelThreshold))
+				{
+					if(data.size() <= std::numeric_limits<uint32_t>::max())
+					{
+						RadixSort<uint32_t>(data, projection, Descending);
+					}
+					else
+					{
+						RadixSort<size_t>(data, projection, Descending);
+					}
+
+					return;
+				}
+			}
+
+			if(data.size() <= std::numeric_limits<uint32_t>::max())
+			{
+				CachedKeySort<uint32_t>(data, comparer, projection, options);
+			}
+			else
+			{
+				CachedKeySort<size_t>(data, comparer, projection, options);
+			}
+		}
+		else if constexpr(IsCompositeProjection<TProjection> && PrefixSortable<T, TComparer, TProjection>)
+		{
+			if(data.size() < RadixThreshold)
+			{
+				std::ranges::stable_sort(data, comparer, projection);
+			}
+			else if(data.size() <= std::numeric_limits<uint32_t>::max())
+			{
+				PrefixSort<uint32_t>(data, comparer, projection, options);
+			}
+			else
+			{
+				PrefixSort<size_t>(data, comparer, projection, options);
+			}
+		}
+		else if constexpr(IsCompositeProjection<TProjection>)
+		{
+			Sort(data, comparer.First, projection.First, options);
+
+			for(auto first = data.begin(); first != data.end();)
+			{
+				auto last = std::find_if(first + 1, data.end(), [&](T& item)
+				{
+					return std::invoke(comparer.First, Unwrap(std::invoke(projection.First, *first)), Unwrap(std::invoke(projection.First, item)));
+				});
+
+				if(last - first > 1)
+				{
+					std::ranges::stable_sort(first, last, comparer.Second, projection.Second);
+				}
+
+				first = last;
+			}
+		}
+		else if(options.Parallel && data.size() >= options.ParallelThreshold)
+		{
+			ParallelSort(data.begin(), data.end(), comparer, projection, options.Concurrency);
+		}
+		else if constexpr(RadixSortable<T, TComparer, TProjection>)
+		{
+			constexpr bool Descending = IsDescending<TComparer, SortKey<T, TComparer, TProjection>>;
+
+			if(data.size() < RadixThreshold)
+			{
+				std::ranges::stable_sort(data, comparer, projection);
+			}
+			else if(data.size() <= std::numeric_limits<uint32_t>::max())
+			{
+				RadixSort<uint32_t>(data, projection, Descending);
+			}
+			else
+			{
+				RadixSort<size_t>(data, projection, Descending);
+			}
+		}
+		else if constexpr(PrefixSortable<T, TComparer, TProjection>)
+		{
+			if(data.size() < RadixThreshold)
+			{
+				std::ranges::stable_sort(data, comparer, projection);
+			}
+			else if(data.size() <= std::numeric_limits<uint32_t>::max())
+			{
+				PrefixSort<uint32_t>(data, comparer, projection, options);
+			}
+			else
+			{
+				PrefixSort<size_t>(data, comparer, projection, options);
+			}
+		}
+		else
+		{
+			std::ranges::stable_sort(data, comparer, projection);
+		}
+	}
+
+	template<typename T, typename TComparer, typename TProjection>
+	constexpr size_t SortFootprint()
+	{
+		struct Entry
+		{
+			uint64_t Key;
+			size_t Index;
+		};
+
+		if constexpr(std::is_same_v<TProjection, std::identity> && std::is_arithmetic_v<T>)
+		{
+			return 2 * sizeof(T);
+		}
+		else if constexpr(CachesKeys<T, TProjection>)
+		{
+			struct CachedEntry
+			{
+				SortKey<T, TComparer, TProjection> Key;
+				size_t Index;
+			};
+
+			return 2 * sizeof(T) + 2 * sizeof(Entry) + 2 * sizeof(CachedEntry);
+		}
+		else
+		{
+			return 2 * sizeof(T) + 2 * sizeof(Entry);
+		}
+	}
+
+	template<std::ranges::random_access_range TRange, typename TComparer, typename TProjection, typename TIndex, typename TAllocator>
+	void SortIndices(TRange&& range, size_t limit, const TComparer& comparer, const TProjection& projection, const SortOptions& options,
+					 std::vector<TIndex, TAllocator>& indices)
+	{
+		auto first = std::ranges::begin(range);
+		auto size = static_cast<TIndex>(std::ranges::distance(range));
+		auto key = [&projection, first](TIndex index) -> decltype(auto)
+		{
+			return std::invoke(projection, first[index]);
+		};
+
+		if(limit < size)
+		{
+			auto top = SelectTop(std::views::iota(TIndex(0), size), limit, comparer, key);
+			indices.assign(top.begin(), top.end());
+			return;
+		}
+
+		indices.resize(size);
+		std::iota(indices.begin(), indices.end(), TIndex(0));
+		Sort(indices, comparer, key, options);
+	}
+
+	template<typename T> requires std::is_trivially_copyable_v<T>
+	class SpillFile
+	{
+	private:
+		struct Run
+		{
+			uint64_t Offset;
+			size_t Size;
+		};
+
+		struct Closer
+		{
+			void operator()(std::FILE* file) const
+			{
+				std::fclose(file);
+			}
+		};
+
+		std::unique_ptr<std::FILE, Closer> _file;
+		std::vector<Run> _runs;
+		std::mutex _mutex;
+		uint64_t _end = 0;
+
+		bool Seek(uint64_t offset)
+		{
+#if defined(_MSC_VER)
+			return _fseeki64(_file.get(), static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+			return fseeko(_file.get(), static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+		}
+	public:
+		SpillFile():
+			_file(std::tmpfile())
+		{
+			if(!_file)
+			{
+				throw std::runtime_error("Failed to create temporary file");
+			}
+		}
+
+		size_t RunCount() const
+		{
+			return _runs.size();
+		}
+
+		size_t RunSize(size_t run) const
+		{
+			return _runs[run].Size;
+		}
+
+		void Write(std::span<const T> items)
+		{
+			std::lock_guard lock(_mutex);
+
+			if(!Seek(_end) ||
+				std::fwrite(items.data(), sizeof(T), items.size(), _file.get()) != items.size())
+			{
+				throw std::runtime_error("Failed to write sorted run");
+			}
+
+			_runs.push_back({ _end, items.size() });
+			_end += items.size() * sizeof(T);
+		}
+
+		void Read(size_t run, size_t position, std::span<T> buffer)
+		{
+			std::lock_guard lock(_mutex);
+
+			if(!Seek(_runs[run].Offset + position * sizeof(T)) ||
+				std::fread(buffer.data(), sizeof(T), buffer.size(), _file.get()) != buffer.size())
+			{
+				throw std::runtime_error("Failed to read sorted run");
+			}
+		}
+	};
+
+	template<typename T, typename TComparer, typename TProjection>
+	class RunMerger
+	{
+	private:
+		struct Cursor
+		{
+			std::vector<T> Storage;
+			std::span<const T> Block;
+			size_t Position = 0;
+			size_t Consumed = 0;
+		};
+
+		std::shared_ptr<SpillFile<T>> _spill;
+		TComparer _comparer;
+		TProjection _projection;
+		size_t _blockSize = 0;
+		std::vector<Cursor> _cursors;
+		std::vector<size_t> _heap;
+	public:
+		RunMerger(std::span<const T> items, TComparer comparer, TProjection projection):
+			_comparer(std::move(comparer)),
+			_projection(std::move(projection)),
+			_cursors(1)
+		{
+			if(!items.empty())
+			{
+				_cursors[0].Block = items;
+				_heap.push_back(0);
+			}
+		}
+
+		RunMerger(std::shared_ptr<SpillFile<T>> spill, size_t memoryBudget, TComparer comparer, TProjection projection):
+			_spill(std::move(spill)),
+			_comparer(std::move(comparer)),
+			_projection(std::move(projection)),
+			_blockSize(std::max<size_t>(1, memoryBudget / sizeof(T) / _spill->RunCount())),
+			_cursors(_spill->RunCount())
+		{
+			for(size_t run = 0; run < _cursors.size(); run++)
+			{
+				Refill(run);
+				_heap.push_back(run);
+			}
+
+			std::make_heap(_heap.begin(), _heap.end(), Later());
+		}
+
+		bool Done() const
+		{
+			return _heap.empty();
+		}
+
+		const T& Current() const
+		{
+			const Cursor& cursor = _cursors[_heap.front()];
+			return cursor.Block[cursor.Position];
+		}
+
+		void Next()
+		{
+			std::pop_heap(_heap.begin(), _heap.end(), Later());
+
+			size_t run = _heap.back();
+			Cursor& cursor = _cursors[run];
+			if(++cursor.Position == cursor.Block.size() && !Refill(run))
+			{
+				_heap.pop_back();
+				return;
+			}
+
+			std::push_heap(_heap.begin(), _heap.end(), Later());
+		}
+	private:
+		auto Later() const
+		{
+			return [this](size_t left, size_t right)
+			{
+				decltype(auto) leftKey = std::invoke(_projection, _cursors[left].Block[_cursors[left].Position]);
+				decltype(auto) rightKey = std::invoke(_projection, _cursors[right].Block[_cursors[right].Position]);
+
+				if(std::invoke(_comparer, rightKey, leftKey))
+				{
+					return true;
+				}
+
+				return !std::invoke(_comparer, leftKey, rightKey) && left > right;
+			};
+		}
+
+		bool Refill(size_t run)
+		{
+			Cursor& cursor = _cursors[run];
+			if(!_spill || cursor.Consumed == _spill->RunSize(run))
+			{
+				return false;
+			}
+
+			size_t count = std::min(_blockSize, _spill->RunSize(run) - cursor.Consumed);
+			cursor.Storage.resize(count);
+			_spill->Read(run, cursor.Consumed, cursor.Storage);
+			cursor.Block = cursor.Storage;
+			cursor.Position = 0;
+			cursor.Consumed += count;
+			return true;
+		}
+	};
+}
@@ -1,9 +1,16 @@
 #pragma once
 
+#include "Sorting.h"
+
 #include <ranges>
 #include <algorithm>
+#include <array>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <unordered_map>
 
@@ -439,52 +446,867 @@ namespace Views
 	template<typename TRange, typename TOtherRange>
 	ConcatView(TRange&&, TOtherRange&&) -> ConcatView<all_t<TRange>, all_t<TOtherRange>>;
 
-	template<view TView, typename TComparer, typename TProjection>
-	class OrderedView : public view_interface<OrderedView<TView, TComparer, TProjection>>
+	template<typename TView>
+	constexpr bool IsOwnedVector = false;
+
+	template<typename T>
+	constexpr bool IsOwnedVector<std::ranges::owning_view<std::vector<T>>> = true;
+
+	template<view TView, typename TComparer, typename TProjection, typename TAllocator = std::allocator<range_value_t<TView>>>
+	class OrderedView : public view_interface<OrderedView<TView, TComparer, TProjection, TAllocator>>
 	{
 	private:
 		using T = range_value_t<TView>;
 
+		static constexpr bool Owned = IsOwnedVector<TView> && std::same_as<TAllocator, std::allocator<T>>;
+		static constexpr bool InlineBuffer = std::is_arithmetic_v<T> && !Owned && sized_range<const TView> && !Sorting::CachesKeys<T, TProjection>;
+
+		struct State
+		{
+			Execution::OnceFlag Once;
+			std::vector<T, TAllocator> Items;
+
+			explicit State(const TAllocator& allocator):
+				Items(allocator)
+			{}
+		};
+
 		TView _view;
 		TComparer _comparer;
 		TProjection _projection;
-		mutable bool _sorted = false;
-		mutable std::vector<T> _sortedRange;
+		Sorting::SortOptions _options;
+		[[no_unique_address]] TAllocator _allocator;
+		size_t _limit = std::numeric_limits<size_t>::max();
+		std::shared_ptr<State> _state;
+		mutable Execution::OnceFlag _once;
+		mutable std::shared_ptr<State> _overflow;
+		[[no_unique_address]] mutable std::array<T, InlineBuffer ? Sorting::SmallSortSize : 0> _inline;
+		mutable size_t _inlineSize = 0;
+
+		template<view, typename, typename, typename>
+		friend class OrderedView;
 	public:
-		constexpr OrderedView(TView view, TComparer comparer, TProjection projection):
+		constexpr OrderedView(TView view, TComparer comparer, TProjection projection, Sorting::SortOptions options = {}, TAllocator allocator = {}):
 			_view(std::move(view)),
 			_comparer(std::move(comparer)),
-			_projection(std::move(projection))
-		{}
-		OrderedView(const OrderedView&) requires std::copyable<TView> = default;
+			_projection(std::move(projection)),
+			_options(options),
+			_allocator(std::move(allocator))
+		{
+			if constexpr(Owned)
+			{
+				_state = MakeState();
+				_state->Items = std::move(_view.base());
+			}
+			else if(!InlineBuffer || !IsSmall())
+			{
+				_state = MakeState();
+			}
+		}
+		OrderedView(const OrderedView& other) requires std::copyable<TView>:
+			_view(other._view),
+			_comparer(other._comparer),
+			_projection(other._projection),
+			_options(other._options),
+			_allocator(other._allocator),
+			_limit(other._limit),
+			_state(other._state),
+			_once(other._once)
+		{
+			if(_once.IsDone())
+			{
+				_overflow = other._overflow;
+				_inline = other._inline;
+				_inlineSize = other._inlineSize;
+			}
+		}
+
 		OrderedView(OrderedView&&) = default;
 
 		constexpr auto begin() const
 		{
 			EnsureSorted();
-			return std::ranges::begin(_sortedRange);
+			return Items().begin();
 		}
 
 		constexpr auto end() const
 		{
 			EnsureSorted();
-			return std::ranges::end(_sortedRange);
+			return Items().begin() + std::min(_limit, Items().size());
+		}
+
+		constexpr OrderedView Take(size_t count) const& requires std::copyable<TView>
+		{
+			return OrderedView(*this).Take(count);
+		}
+
+		constexpr OrderedView Take(size_t count) &&
+		{
+			if(count < _limit)
+			{
+				_limit = count;
+				Detach();
+			}
+
+			return std::move(*this);
+		}
+
+		constexpr T ElementAt(size_t position) const
+		{
+			if(IsSorted())
+			{
+				if(position >= std::min(_limit, Items().size()))
+				{
+					throw std::out_of_range("Position is out of range");
+				}
+
+				return Items()[position];
+			}
+
+			if constexpr(Owned)
+			{
+				const std::vector<T>& items = _state->Items;
+				if(position >= std::min(_limit, items.size()))
+				{
+					throw std::out_of_range("Position is out of range");
+				}
+
+				return items[Sorting::NthIndex(items, position, _comparer, _projection)];
+			}
+			else
+			{
+				std::vector<T> items(std::ranges::begin(_view), std::ranges::end(_view));
+				if(position >= std::min(_limit, items.size()))
+				{
+					throw std::out_of_range("Position is out of range");
+				}
+
+				return std::move(items[Sorting::NthIndex(items, position, _comparer, _projection)]);
+			}
+		}
+
+		template<typename TOtherComparer, typename TOtherProjection>
+		constexpr auto ThenBy(TOtherComparer comparer, TOtherProjection projection) const& requires std::copyable<TView>
+		{
+			return OrderedView(*this).ThenBy(std::move(comparer), std::move(projection));
+		}
+
+		template<typename TOtherComparer, typename TOtherProjection>
+		constexpr auto ThenBy(TOtherComparer comparer, TOtherProjection projection) &&
+		{
+			using TThenComparer = Sorting::LexicographicComparer<TComparer, TOtherComparer>;
+			using TThenProjection = Sorting::CompositeProjection<TProjection, TOtherProjection>;
+
+			if(_limit != std::numeric_limits<size_t>::max())
+			{
+				throw std::logic_error("ThenBy cannot follow Take");
+			}
+
+			OrderedView<TView, TThenComparer, TThenProjection, TAllocator> view(
+				std::move(_view),
+				TThenComparer(std::move(_comparer), std::move(comparer)),
+				TThenProjection(std::move(_projection), std::move(projection)),
+				_options,
+				_allocator);
+
+			if constexpr(Owned)
+			{
+				view._state->Items = std::move(_state->Items);
+			}
+
+			return view;
+		}
+
+		OrderedView& operator=(const OrderedView& other) requires std::copyable<TView>
+		{
+			return *this = OrderedView(other);
 		}
 
-		OrderedView& operator=(const OrderedView&) requires std::copyable<TView> = default;
 		OrderedView& operator=(OrderedView&&) = default;
 	private:
+		std::shared_ptr<State> MakeState() const
+		{
+			return std::allocate_shared<State>(_allocator, _allocator);
+		}
+
+		constexpr std::span<const T> Items() const
+		{
+			if constexpr(InlineBuffer)
+			{
+				if(!_state)
+				{
+					return _overflow ? std::span<const T>(_overflow->Items) : std::span<const T>(_inline.data(), _inlineSize);
+				}
+			}
+
+			return _state->Items;
+		}
+
+		constexpr bool IsSorted() const
+		{
+			return _state ? _state->Once.IsDone() : _once.IsDone();
+		}
+
+		constexpr bool IsSmall() const
+		{
+			if constexpr(InlineBuffer)
+			{
+				return std::ranges::size(_view) <= _inline.size();
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		constexpr void Detach()
+		{
+			if constexpr(!Owned)
+			{
+				if(_state && !_state->Once.IsDone())
+				{
+					_state = MakeState();
+				}
+			}
+		}
+
 		constexpr void EnsureSorted() const
 		{
-			if(!_sorted)
+			if(_state)
+			{
+				_state->Once.Call([this] { Materialize(*_state); });
+				return;
+			}
+
+			if constexpr(InlineBuffer)
+			{
+				_once.Call([this]
+				{
+					if(IsSmall())
+					{
+						_inlineSize = std::ranges::size(_view);
+						std::ranges::copy(_view, _inline.begin());
+						Sorting::SortSmall(_inline.data(), _inlineSize, _comparer, _projection);
+					}
+					else
+					{
+						_overflow = MakeState();
+						Materialize(*_overflow);
+					}
+				});
+			}
+		}
+
+		constexpr void Materialize(State& state) const
+		{
+			if(_limit != std::numeric_limits<size_t>::max() && !IsWithinLimit(state))
+			{
+				if constexpr(Owned)
+				{
+					auto items = std::ranges::subrange(std::make_move_iterator(state.Items.begin()), std::make_move_iterator(state.Items.end()));
+					state.Items = Sorting::SelectTop(items, _limit, _comparer, _projection);
+				}
+				else if constexpr(std::same_as<TAllocator, std::allocator<T>>)
+				{
+					state.Items = Sorting::SelectTop(_view, _limit, _comparer, _projection);
+				}
+				else
+				{
+					std::vector<T> top = Sorting::SelectTop(_view, _limit, _comparer, _projection);
+					state.Items.assign(std::make_move_iterator(top.begin()), std::make_move_iterator(top.end()));
+				}
+			}
+			else if constexpr(Owned)
+			{
+				if(_options.Stable)
+				{
+					Sorting::Sort(state.Items, _comparer, _projection, _options);
+				}
+				else
+				{
+					std::ranges::sort(state.Items, _comparer, _projection);
+				}
+			}
+			else
+			{
+				state.Items.assign(std::ranges::begin(_view), std::ranges::end(_view));
+				Sorting::Sort(state.Items, _comparer, _projection, _options);
+			}
+		}
+
+		constexpr bool IsWithinLimit(const State& state) const
+		{
+			if constexpr(Owned)
 			{
-				_sorted = true;
-				_sortedRange = std::vector(std::ranges::begin(_view), std::ranges::end(_view));
-				std::ranges::sort(_sortedRange, _comparer, _projection);
+				return state.Items.size() <= _limit;
+			}
+			else if constexpr(sized_range<const TView>)
+			{
+				return std::ranges::size(_view) <= _limit;
+			}
+			else
+			{
+				return false;
 			}
 		}
 	};
 
 	template<typename TRange, typename TComparer, typename TProjection>
 	OrderedView(TRange&&, TComparer, TProjection) -> OrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	OrderedView(TRange&&, TComparer, TProjection, Sorting::SortOptions) -> OrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection, typename TAllocator>
+	OrderedView(TRange&&, TComparer, TProjection, Sorting::SortOptions, TAllocator)
+		-> OrderedView<all_t<TRange>, TComparer, TProjection, Sorting::ReboundAllocator<TAllocator, range_value_t<all_t<TRange>>>>;
+
+	template<view TView, typename TComparer, typename TProjection>
+		requires std::ranges::input_range<const TView> && std::is_trivially_copyable_v<range_value_t<TView>>
+	class ExternalOrderedView : public view_interface<ExternalOrderedView<TView, TComparer, TProjection>>
+	{
+	private:
+		using T = range_value_t<TView>;
+		using TMerger = Sorting::RunMerger<T, TComparer, TProjection>;
+
+		struct State
+		{
+			Execution::OnceFlag Once;
+			std::vector<T> Items;
+			std::shared_ptr<Sorting::SpillFile<T>> Spill;
+		};
+
+		class MergeIterator
+		{
+		private:
+			std::shared_ptr<TMerger> _merger;
+		public:
+			using value_type = T;
+			using difference_type = ptrdiff_t;
+
+			MergeIterator() = default;
+
+			explicit MergeIterator(std::shared_ptr<TMerger> merger):
+				_merger(std::move(merger))
+			{}
+
+			const T& operator*() const
+			{
+				return _merger->Current();
+			}
+
+			MergeIterator& operator++()
+			{
+				_merger->Next();
+				return *this;
+			}
+
+			void operator++(int)
+			{
+				++*this;
+			}
+
+			friend bool operator==(const MergeIterator& iterator, std::default_sentinel_t)
+			{
+				return !iterator._merger || iterator._merger->Done();
+			}
+		};
+
+		TView _view;
+		TComparer _comparer;
+		TProjection _projection;
+		Sorting::ExternalSortOptions _options;
+		std::shared_ptr<State> _state = std::make_shared<State>();
+	public:
+		constexpr ExternalOrderedView(TView view, TComparer comparer, TProjection projection, Sorting::ExternalSortOptions options = {}):
+			_view(std::move(view)),
+			_comparer(std::move(comparer)),
+			_projection(std::move(projection)),
+			_options(options)
+		{}
+
+		ExternalOrderedView(const ExternalOrderedView&) requires std::copyable<TView> = default;
+		ExternalOrderedView(ExternalOrderedView&&) = default;
+
+		MergeIterator begin() const
+		{
+			_state->Once.Call([this] { Spill(*_state); });
+
+			if(_state->Spill)
+			{
+				return MergeIterator(std::make_shared<TMerger>(_state->Spill, _options.MemoryBudget, _comparer, _projection));
+			}
+
+			return MergeIterator(std::make_shared<TMerger>(_state->Items, _comparer, _projection));
+		}
+
+		std::default_sentinel_t end() const
+		{
+			return std::default_sentinel;
+		}
+
+		ExternalOrderedView& operator=(const ExternalOrderedView&) requires std::copyable<TView> = default;
+		ExternalOrderedView& operator=(ExternalOrderedView&&) = default;
+	private:
+		void Spill(State& state) const
+		{
+			size_t runSize = std::max<size_t>(1, _options.MemoryBudget / Sorting::SortFootprint<T, TComparer, TProjection>());
+
+			std::vector<T> run;
+			if constexpr(sized_range<const TView>)
+			{
+				run.reserve(std::min<size_t>(runSize, std::ranges::size(_view)));
+			}
+			else
+			{
+				run.reserve(runSize);
+			}
+
+			for(auto&& item : _view)
+			{
+				if(run.size() == runSize)
+				{
+					Sorting::Sort(run, _comparer, _projection, {});
+
+					if(!state.Spill)
+					{
+						state.Spill = std::make_shared<Sorting::SpillFile<T>>();
+					}
+
+					state.Spill->Write(run);
+					run.clear();
+				}
+
+				run.push_back(std::forward<decltype(item)>(item));
+			}
+
+			Sorting::Sort(run, _comparer, _projection, {});
+
+			if(!state.Spill)
+			{
+				state.Items = std::move(run);
+			}
+			else if(!run.empty())
+			{
+				state.Spill->Write(run);
+			}
+		}
+	};
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	ExternalOrderedView(TRange&&, TComparer, TProjection) -> ExternalOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	ExternalOrderedView(TRange&&, TComparer, TProjection, Sorting::ExternalSortOptions) -> ExternalOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<view TView, typename TComparer, typename TProjection>
+		requires std::ranges::forward_range<const TView> && sized_range<const TView>
+	class LiveOrderedView : public view_interface<LiveOrderedView<TView, TComparer, TProjection>>
+	{
+	private:
+		using T = range_value_t<TView>;
+
+		TView _view;
+		TComparer _comparer;
+		TProjection _projection;
+		Sorting::SortOptions _options;
+		std::vector<T> _items;
+		size_t _consumed = 0;
+		bool _refreshed = false;
+	public:
+		constexpr LiveOrderedView(TView view, TComparer comparer, TProjection projection, Sorting::SortOptions options = {}):
+			_view(std::move(view)),
+			_comparer(std::move(comparer)),
+			_projection(std::move(projection)),
+			_options(options)
+		{}
+
+		LiveOrderedView(const LiveOrderedView&) requires std::copyable<TView> = default;
+		LiveOrderedView(LiveOrderedView&&) = default;
+
+		constexpr auto begin()
+		{
+			EnsureRefreshed();
+			return _items.begin();
+		}
+
+		constexpr auto end()
+		{
+			EnsureRefreshed();
+			return _items.end();
+		}
+
+		constexpr size_t size()
+		{
+			EnsureRefreshed();
+			return _items.size();
+		}
+
+		constexpr size_t Consumed() const
+		{
+			return _consumed;
+		}
+
+		constexpr void Refresh()
+		{
+			_refreshed = true;
+			size_t size = std::ranges::size(_view);
+			if(size < _consumed)
+			{
+				throw std::logic_error("Source range has shrunk");
+			}
+
+			if(size == _consumed)
+			{
+				return;
+			}
+
+			std::vector<T> tail(std::ranges::next(std::ranges::begin(_view), _consumed), std::ranges::end(_view));
+			Sorting::Sort(tail, _comparer, _projection, _options);
+			_consumed = size;
+
+			size_t middle = _items.size();
+			bool ordered = middle == 0 || !std::invoke(_comparer, std::invoke(_projection, tail.front()), std::invoke(_projection, _items.back()));
+			_items.insert(_items.end(), std::make_move_iterator(tail.begin()), std::make_move_iterator(tail.end()));
+
+			if(!ordered)
+			{
+				std::ranges::inplace_merge(_items.begin(), _items.begin() + middle, _items.end(), _comparer, _projection);
+			}
+		}
+
+		LiveOrderedView& operator=(const LiveOrderedView&) requires std::copyable<TView> = default;
+		LiveOrderedView& operator=(LiveOrderedView&&) = default;
+	private:
+		constexpr void EnsureRefreshed()
+		{
+			if(!_refreshed)
+			{
+				Refresh();
+			}
+		}
+	};
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	LiveOrderedView(TRange&&, TComparer, TProjection) -> LiveOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	LiveOrderedView(TRange&&, TComparer, TProjection, Sorting::SortOptions) -> LiveOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<view TView, typename TComparer, typename TProjection, typename TAllocator = std::allocator<std::byte>>
+		requires std::ranges::random_access_range<const TView> && sized_range<const TView>
+	class IndirectOrderedView : public view_interface<IndirectOrderedView<TView, TComparer, TProjection, TAllocator>>
+	{
+	private:
+		struct State
+		{
+			Execution::OnceFlag Once;
+			std::vector<uint32_t, Sorting::ReboundAllocator<TAllocator, uint32_t>> Narrow;
+			std::vector<size_t, Sorting::ReboundAllocator<TAllocator, size_t>> Wide;
+
+			explicit State(const TAllocator& allocator):
+				Narrow(allocator),
+				Wide(allocator)
+			{}
+		};
+
+		TView _view;
+		TComparer _comparer;
+		TProjection _projection;
+		Sorting::SortOptions _options;
+		[[no_unique_address]] TAllocator _allocator;
+		size_t _limit = std::numeric_limits<size_t>::max();
+		std::shared_ptr<State> _state;
+
+		template<view TOtherView, typename, typename, typename>
+			requires std::ranges::random_access_range<const TOtherView> && sized_range<const TOtherView>
+		friend class IndirectOrderedView;
+
+		class PermutationIterator
+		{
+		private:
+			const IndirectOrderedView* _parent {};
+			ptrdiff_t _position = 0;
+		public:
+			using iterator_concept = std::random_access_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = range_value_t<const TView>;
+			using difference_type = ptrdiff_t;
+
+			constexpr PermutationIterator() = default;
+
+			constexpr PermutationIterator(const IndirectOrderedView& parent, ptrdiff_t position):
+				_parent(&parent),
+				_position(position)
+			{}
+
+			constexpr range_reference_t<const TView> operator*() const
+			{
+				return (*this)[0];
+			}
+
+			constexpr range_reference_t<const TView> operator[](difference_type offset) const
+			{
+				size_t position = static_cast<size_t>(_position + offset);
+				const State& state = *_parent->_state;
+				size_t index = state.Wide.empty() ? state.Narrow[position] : state.Wide[position];
+				return std::ranges::begin(_parent->_view)[index];
+			}
+
+			constexpr PermutationIterator& operator++()
+			{
+				++_position;
+				return *this;
+			}
+
+			constexpr PermutationIterator operator++(int)
+			{
+				PermutationIterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			constexpr PermutationIterator& operator--()
+			{
+				--_position;
+				return *this;
+			}
+
+			constexpr PermutationIterator operator--(int)
+			{
+				PermutationIterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+
+			constexpr PermutationIterator& operator+=(difference_type offset)
+			{
+				_position += offset;
+				return *this;
+			}
+
+			constexpr PermutationIterator& operator-=(difference_type offset)
+			{
+				_position -= offset;
+				return *this;
+			}
+
+			constexpr friend PermutationIterator operator+(PermutationIterator it, difference_type offset)
+			{
+				return it += offset;
+			}
+
+			constexpr friend PermutationIterator operator+(difference_type offset, PermutationIterator it)
+			{
+				return it += offset;
+			}
+
+			constexpr friend PermutationIterator operator-(PermutationIterator it, difference_type offset)
+			{
+				return it -= offset;
+			}
+
+			constexpr friend difference_type operator-(const PermutationIterator& left, const PermutationIterator& right)
+			{
+				return left._position - right._position;
+			}
+
+			constexpr bool operator==(const PermutationIterator& other) const
+			{
+				return _position == other._position;
+			}
+
+			constexpr auto operator<=>(const PermutationIterator& other) const
+			{
+				return _position <=> other._position;
+			}
+		};
+	public:
+		constexpr IndirectOrderedView(TView view, TComparer comparer, TProjection projection, Sorting::SortOptions options = {}, TAllocator allocator = {}):
+			_view(std::move(view)),
+			_comparer(std::move(comparer)),
+			_projection(std::move(projection)),
+			_options(options),
+			_allocator(std::move(allocator)),
+			_state(std::make_shared<State>(_allocator))
+		{}
+		IndirectOrderedView(const IndirectOrderedView&) requires std::copyable<TView> = default;
+		IndirectOrderedView(IndirectOrderedView&&) = default;
+
+		constexpr auto begin() const
+		{
+			EnsureSorted();
+			return PermutationIterator(*this, 0);
+		}
+
+		constexpr auto end() const
+		{
+			EnsureSorted();
+			size_t size = _state->Wide.empty() ? _state->Narrow.size() : _state->Wide.size();
+			return PermutationIterator(*this, static_cast<ptrdiff_t>(std::min(_limit, size)));
+		}
+
+		constexpr IndirectOrderedView Take(size_t count) const& requires std::copyable<TView>
+		{
+			return IndirectOrderedView(*this).Take(count);
+		}
+
+		constexpr IndirectOrderedView Take(size_t count) &&
+		{
+			if(count < _limit)
+			{
+				_limit = count;
+
+				if(!_state->Once.IsDone())
+				{
+					_state = std::make_shared<State>(_allocator);
+				}
+			}
+
+			return std::move(*this);
+		}
+
+		constexpr range_reference_t<const TView> ElementAt(size_t position) const
+		{
+			if(position >= std::min<size_t>(_limit, std::ranges::size(_view)))
+			{
+				throw std::out_of_range("Position is out of range");
+			}
+
+			if(_state->Once.IsDone())
+			{
+				return begin()[static_cast<ptrdiff_t>(position)];
+			}
+
+			return std::ranges::begin(_view)[Sorting::NthIndex(_view, position, _comparer, _projection)];
+		}
+
+		template<typename TOtherComparer, typename TOtherProjection>
+		constexpr auto ThenBy(TOtherComparer comparer, TOtherProjection projection) const& requires std::copyable<TView>
+		{
+			return IndirectOrderedView(*this).ThenBy(std::move(comparer), std::move(projection));
+		}
+
+		template<typename TOtherComparer, typename TOtherProjection>
+		constexpr auto ThenBy(TOtherComparer comparer, TOtherProjection projection) &&
+		{
+			using TThenComparer = Sorting::LexicographicComparer<TComparer, TOtherComparer>;
+			using TThenProjection = Sorting::CompositeProjection<TProjection, TOtherProjection>;
+
+			if(_limit != std::numeric_limits<size_t>::max())
+			{
+				throw std::logic_error("ThenBy cannot follow Take");
+			}
+
+			IndirectOrderedView<TView, TThenComparer, TThenProjection, TAllocator> view(
+				std::move(_view),
+				TThenComparer(std::move(_comparer), std::move(comparer)),
+				TThenProjection(std::move(_projection), std::move(projection)),
+				_options,
+				_allocator);
+			return view;
+		}
+
+		IndirectOrderedView& operator=(const IndirectOrderedView&) requires std::copyable<TView> = default;
+		IndirectOrderedView& operator=(IndirectOrderedView&&) = default;
+	private:
+		constexpr void EnsureSorted() const
+		{
+			_state->Once.Call([this]
+			{
+				if(std::ranges::size(_view) <= std::numeric_limits<uint32_t>::max())
+				{
+					Sorting::SortIndices(_view, _limit, _comparer, _projection, _options, _state->Narrow);
+				}
+				else
+				{
+					Sorting::SortIndices(_view, _limit, _comparer, _projection, _options, _state->Wide);
+				}
+			});
+		}
+	};
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	IndirectOrderedView(TRange&&, TComparer, TProjection) -> IndirectOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection>
+	IndirectOrderedView(TRange&&, TComparer, TProjection, Sorting::SortOptions) -> IndirectOrderedView<all_t<TRange>, TComparer, TProjection>;
+
+	template<typename TRange, typename TComparer, typename TProjection, typename TAllocator>
+	IndirectOrderedView(TRange&&, TComparer, TProjection, Sorting::SortOptions, TAllocator)
+		-> IndirectOrderedView<all_t<TRange>, TComparer, TProjection, Sorting::ReboundAllocator<TAllocator, std::byte>>;
+
+	template<typename T>
+	constexpr bool IsOrderedView = false;
+
+	template<typename TView, typename TComparer, typename TProjection, typename TAllocator>
+	constexpr bool IsOrderedView<OrderedView<TView, TComparer, TProjection, TAllocator>> = true;
+
+	template<typename TView, typename TComparer, typename TProjection, typename TAllocator>
+	constexpr bool IsOrderedView<IndirectOrderedView<TView, TComparer, TProjection, TAllocator>> = true;
+
+	template<view TView>
+	class ParallelView : public view_interface<ParallelView<TView>>
+	{
+	private:
+		TView _view;
+		size_t _concurrency = 0;
+	public:
+		constexpr ParallelView() requires std::default_initializable<TView> = default;
+
+		constexpr ParallelView(TView view, size_t concurrency):
+			_view(std::move(view)),
+			_concurrency(concurrency)
+		{}
+
+		ParallelView(const ParallelView&) requires std::copyable<TView> = default;
+		ParallelView(ParallelView&&) = default;
+
+		constexpr auto begin()
+		{
+			return std::ranges::begin(_view);
+		}
+
+		constexpr auto begin() const requires std::ranges::range<const TView>
+		{
+			return std::ranges::begin(_view);
+		}
+
+		constexpr auto end()
+		{
+			return std::ranges::end(_view);
+		}
+
+		constexpr auto end() const requires std::ranges::range<const TView>
+		{
+			return std::ranges::end(_view);
+		}
+
+		constexpr auto size() requires sized_range<TView>
+		{
+			return std::ranges::size(_view);
+		}
+
+		constexpr auto size() const requires sized_range<const TView>
+		{
+			return std::ranges::size(_view);
+		}
+
+		constexpr size_t Concurrency() const
+		{
+			return _concurrency;
+		}
+
+		ParallelView& operator=(const ParallelView&) requires std::copyable<TView> = default;
+		ParallelView& operator=(ParallelView&&) = default;
+	};
+
+	template<typename TRange>
+	ParallelView(TRange&&, size_t) -> ParallelView<all_t<TRange>>;
+
+	template<typename T>
+	constexpr bool IsParallelView = false;
+
+	template<typename TView>
+	constexpr bool IsParallelView<ParallelView<TView>> = true;
 }
\ No newline at end of file